@@ -100,12 +100,15 @@ option(USE_COREPCH         "Use precompiled headers when compiling servers"
 option(WITH_WARNINGS       "Show all warnings during compile"                            0)
 option(WITH_COREDEBUG      "Include additional debug-code in core"                       0)
 option(WITH_PERFTOOLS      "Enable compilation with gperftools libraries included"       0)
+option(WITH_IO_URING       "Use io_uring instead of epoll for network sockets (Linux only)" 0)
 option(WITHOUT_GIT         "Disable the GIT testing routines"                            0)
 option(ENABLE_VMAP_CHECKS  "Enable Checks relative to DisableMgr system on vmap"         1)
+option(WITH_EVENT_TIMING_WHEEL "Use a hierarchical timing wheel as EventProcessor queue"  0)
 option(WITH_DYNAMIC_LINKING "Enable dynamic library linking."                            0)
 option(WITH_STRICT_DATABASE_TYPE_CHECKS "Enable strict checking of database field value accessors" 0)
 option(WITHOUT_METRICS     "Disable metrics reporting (i.e. InfluxDB and Grafana)"       0)
 option(WITH_DETAILED_METRICS  "Enable detailed metrics reporting (i.e. time each session takes to update)" 0)
+set(LOG_MAX_LEVEL 6 CACHE STRING "Highest log level compiled in, more verbose messages are left out (1 fatal - 6 trace)")
 
 CheckApplicationsBuildList()
 CheckToolsBuildList()
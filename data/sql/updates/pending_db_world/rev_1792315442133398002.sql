@@ -0,0 +1,5 @@
+--
+DELETE FROM `command` WHERE `name` IN ('debug profile start', 'debug profile stop');
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug profile start', 3, 'Syntax: .debug profile start\nStarts recording where the server threads spend their time, broken down by map, opcode, script hook, creature AI, SmartScript and spell.'),
+('debug profile stop', 3, 'Syntax: .debug profile stop\nEnds the recording and writes it to the logs directory as collapsed stacks in microseconds, ready for flamegraph.pl.');
@@ -0,0 +1,38 @@
+# Tries to find liburing.
+#
+# Usage of this module as follows:
+#
+#     find_package(Liburing)
+#
+# Variables used by this module, they can change the default behaviour and need
+# to be set before calling find_package:
+#
+#  Liburing_ROOT_DIR  Set this variable to the root installation of
+#                     liburing if the module has problems finding
+#                     the proper installation path.
+#
+# Variables defined by this module:
+#
+#  LIBURING_FOUND              System has liburing libs/headers
+#  LIBURING_LIBRARIES          The liburing library
+#  LIBURING_INCLUDE_DIR        The location of liburing headers
+
+find_library(LIBURING_LIBRARIES
+  NAMES uring
+  HINTS ${Liburing_ROOT_DIR}/lib)
+
+find_path(LIBURING_INCLUDE_DIR
+  NAMES liburing.h
+  HINTS ${Liburing_ROOT_DIR}/include)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+  Liburing
+  DEFAULT_MSG
+  LIBURING_LIBRARIES
+  LIBURING_INCLUDE_DIR)
+
+mark_as_advanced(
+  Liburing_ROOT_DIR
+  LIBURING_LIBRARIES
+  LIBURING_INCLUDE_DIR)
@@ -96,6 +96,16 @@ if ( UNIX )
   else()
     message("* Use unix gperftools             : No  (default)")
   endif()
+
+  if( WITH_IO_URING )
+    if( LIBURING_FOUND )
+      message("* Use io_uring network backend    : Requested (used with Boost 1.78+, see the Boost status below)")
+    else()
+      message("* Use io_uring network backend    : No  (liburing not found, using epoll)")
+    endif()
+  else()
+    message("* Use io_uring network backend    : No  (default)")
+  endif()
 endif( UNIX )
 
 if( WIN32 )
@@ -138,6 +148,13 @@ else()
   message("* Enable vmap DisableMgr checks   : No")
 endif()
 
+if( WITH_EVENT_TIMING_WHEEL )
+  message("* Use EventProcessor timing wheel : Yes")
+  add_definitions(-DEVENT_TIMING_WHEEL)
+else()
+  message("* Use EventProcessor timing wheel : No  (default)")
+endif()
+
 if(WIN32)
   if(NOT WITH_SOURCE_TREE STREQUAL "no")
   message("* Show source tree                : Yes - \"${WITH_SOURCE_TREE}\"")
@@ -168,6 +185,14 @@ elseif (WITH_DETAILED_METRICS)
   add_definitions(-DWITH_DETAILED_METRICS)
 endif()
 
+if(LOG_MAX_LEVEL LESS 6)
+  message("")
+  message(" *** LOG_MAX_LEVEL - WARNING!")
+  message(" *** Log messages more verbose than level ${LOG_MAX_LEVEL} are left out at compile time")
+  message(" *** and can not be enabled in the configuration")
+  add_definitions(-DACORE_LOG_MAX_LEVEL=${LOG_MAX_LEVEL})
+endif()
+
 if(MSAN)
     message("")
     message(" *** MSAN - WARNING!")
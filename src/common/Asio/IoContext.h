@@ -21,6 +21,12 @@
 #include <boost/version.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
+#include <string>
+
+#ifdef BOOST_ASIO_HAS_IO_URING
+#include <cstring>
+#include <liburing.h>
+#endif
 #define IoContextBaseNamespace boost::asio
 #define IoContextBase io_context
 
@@ -44,6 +50,26 @@ namespace Acore::Asio
         IoContextBaseNamespace::IoContextBase _impl;
     };
 
+    // Asio built for io_uring has no epoll to fall back to, io_context throws if the kernel
+    // lacks io_uring or it is blocked (e.g. by the default seccomp profile of Docker)
+    inline bool IsBackendAvailable(std::string& error)
+    {
+#ifdef BOOST_ASIO_HAS_IO_URING
+        io_uring ring;
+        int result = io_uring_queue_init(1, &ring, 0);
+        if (result < 0)
+        {
+            error = std::strerror(-result);
+            return false;
+        }
+
+        io_uring_queue_exit(&ring);
+#else
+        (void)error;
+#endif
+        return true;
+    }
+
     template<typename T>
     inline decltype(auto) post(IoContextBaseNamespace::IoContextBase& ioContext, T&& t)
     {
@@ -31,6 +31,11 @@
 #include <stdexcept>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BIH_RAY_PACKET_SSE
+#include <xmmintrin.h>
+#endif
+
 #define MAX_STACK_SIZE 64
 
 // https://stackoverflow.com/a/4328396
@@ -280,6 +285,203 @@ public:
         }
     }
 
+    static constexpr uint32 RAY_PACKET_SIZE = 4;
+
+    /**
+        Traces up to RAY_PACKET_SIZE rays through the tree together, each ray stops at its first hit.
+        Nodes are not visited front to back, so this only answers occlusion queries and never
+        reports which primitive is the closest one. Returns a bit mask of the rays that hit something.
+    */
+    template<typename RayCallback>
+    uint32 intersectRayPacket(G3D::Ray const* rays, float const* maxDist, uint32 count, RayCallback& intersectCallback) const
+    {
+        count = std::min(count, RAY_PACKET_SIZE);
+
+#if defined(BIH_RAY_PACKET_SSE)
+        alignas(16) float org[3][RAY_PACKET_SIZE];
+        alignas(16) float invDir[3][RAY_PACKET_SIZE];
+        alignas(16) float intervalMin[RAY_PACKET_SIZE];
+        alignas(16) float intervalMax[RAY_PACKET_SIZE];
+
+        uint32 alive = 0;
+        for (uint32 i = 0; i < RAY_PACKET_SIZE; ++i)
+        {
+            // unused lanes get an empty interval and never become active
+            intervalMin[i] = G3D::finf();
+            intervalMax[i] = -G3D::finf();
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                org[axis][i] = i < count ? rays[i].origin()[axis] : 0.f;
+                invDir[axis][i] = i < count ? 1.f / rays[i].direction()[axis] : 1.f;
+            }
+
+            if (i < count && clipRayToBounds(rays[i], maxDist[i], intervalMin[i], intervalMax[i]))
+            {
+                alive |= 1 << i;
+            }
+        }
+
+        if (!alive)
+        {
+            return 0;
+        }
+
+        __m128 const orgV[3] = { _mm_load_ps(org[0]), _mm_load_ps(org[1]), _mm_load_ps(org[2]) };
+        __m128 const invDirV[3] = { _mm_load_ps(invDir[0]), _mm_load_ps(invDir[1]), _mm_load_ps(invDir[2]) };
+        // the sign of the inverse direction tells which side of a split plane a ray starts on, also for -0 directions
+        __m128 const negative[3] =
+        {
+            _mm_cmplt_ps(invDirV[0], _mm_setzero_ps()),
+            _mm_cmplt_ps(invDirV[1], _mm_setzero_ps()),
+            _mm_cmplt_ps(invDirV[2], _mm_setzero_ps())
+        };
+
+        // a ray exactly on a split plane with zero direction on that axis gives NaN here, the operand order
+        // of _mm_min_ps/_mm_max_ps keeps the current interval in that case so the ray visits both sides
+        auto planeDistance = [&](uint32 axis, uint32 planeBits)
+        {
+            return _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(intBitsToFloat(planeBits)), orgV[axis]), invDirV[axis]);
+        };
+        auto select = [](__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        };
+
+        PacketStackNode stack[MAX_STACK_SIZE];
+        int stackPos = 0;
+        int node = 0;
+        __m128 tMin = _mm_load_ps(intervalMin);
+        __m128 tMax = _mm_load_ps(intervalMax);
+        uint32 hitMask = 0;
+
+        while (true)
+        {
+            uint32 active = uint32(_mm_movemask_ps(_mm_cmple_ps(tMin, tMax))) & alive;
+            if (active)
+            {
+                uint32 tn = tree[node];
+                uint32 axis = (tn & (3 << 30)) >> 30; // cppcheck-suppress integerOverflow
+                bool BVH2 = tn & (1 << 29); // cppcheck-suppress integerOverflow
+                int offset = tn & ~(7 << 29); // cppcheck-suppress integerOverflow
+                if (!BVH2)
+                {
+                    if (axis < 3)
+                    {
+                        // "normal" interior node, left child lies below the first plane, right child above the second
+                        __m128 tl = planeDistance(axis, tree[node + 1]);
+                        __m128 tr = planeDistance(axis, tree[node + 2]);
+                        __m128 leftMin = select(negative[axis], _mm_max_ps(tl, tMin), tMin);
+                        __m128 leftMax = select(negative[axis], tMax, _mm_min_ps(tl, tMax));
+                        __m128 rightMin = select(negative[axis], tMin, _mm_max_ps(tr, tMin));
+                        __m128 rightMax = select(negative[axis], _mm_min_ps(tr, tMax), tMax);
+
+                        bool leftActive = (uint32(_mm_movemask_ps(_mm_cmple_ps(leftMin, leftMax))) & alive) != 0;
+                        bool rightActive = (uint32(_mm_movemask_ps(_mm_cmple_ps(rightMin, rightMax))) & alive) != 0;
+                        if (leftActive && rightActive)
+                        {
+                            stack[stackPos].node = offset + 3;
+                            stack[stackPos].tnear = rightMin;
+                            stack[stackPos].tfar = rightMax;
+                            stackPos++;
+                        }
+
+                        if (leftActive)
+                        {
+                            node = offset;
+                            tMin = leftMin;
+                            tMax = leftMax;
+                            continue;
+                        }
+
+                        if (rightActive)
+                        {
+                            node = offset + 3;
+                            tMin = rightMin;
+                            tMax = rightMax;
+                            continue;
+                        }
+                    }
+                    else
+                    {
+                        // leaf - test some objects against every ray that reached it
+                        int n = tree[node + 1];
+                        while (n > 0 && active)
+                        {
+                            for (uint32 i = 0; i < count; ++i)
+                            {
+                                if (!(active & (1 << i)))
+                                {
+                                    continue;
+                                }
+
+                                float distance = maxDist[i];
+                                if (intersectCallback(rays[i], objects[offset], distance, true))
+                                {
+                                    hitMask |= 1 << i;
+                                    alive &= ~(1 << i);
+                                    active &= ~(1 << i);
+                                }
+                            }
+                            --n;
+                            ++offset;
+                        }
+
+                        if (!alive)
+                        {
+                            return hitMask;
+                        }
+                    }
+                }
+                else
+                {
+                    if (axis > 2)
+                    {
+                        return hitMask;    // should not happen
+                    }
+                    // BVH2 node, the child lies between both planes
+                    __m128 tl = planeDistance(axis, tree[node + 1]);
+                    __m128 tr = planeDistance(axis, tree[node + 2]);
+                    tMin = _mm_max_ps(select(negative[axis], tr, tl), tMin);
+                    tMax = _mm_min_ps(select(negative[axis], tl, tr), tMax);
+                    node = offset;
+                    continue;
+                }
+            }
+
+            // stack is empty?
+            if (stackPos == 0)
+            {
+                return hitMask;
+            }
+            // move back up the stack
+            stackPos--;
+            node = stack[stackPos].node;
+            tMin = stack[stackPos].tnear;
+            tMax = stack[stackPos].tfar;
+        }
+#else
+        uint32 hitMask = 0;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            bool hit = false;
+            auto callback = [&](G3D::Ray const& ray, uint32 entry, float& distance, bool stopAtFirstHit)
+            {
+                bool result = intersectCallback(ray, entry, distance, stopAtFirstHit);
+                hit = hit || result;
+                return result;
+            };
+
+            float distance = maxDist[i];
+            intersectRay(rays[i], callback, distance, true);
+            if (hit)
+            {
+                hitMask |= 1 << i;
+            }
+        }
+        return hitMask;
+#endif
+    }
+
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& p, IsectCallback& intersectCallback) const
     {
@@ -393,6 +595,56 @@ protected:
         float tnear;
         float tfar;
     };
+#if defined(BIH_RAY_PACKET_SSE)
+    struct PacketStackNode
+    {
+        __m128 tnear;
+        __m128 tfar;
+        uint32 node;
+    };
+#endif
+
+    // Clips a ray against the tree bounds, same as the start of intersectRay
+    bool clipRayToBounds(G3D::Ray const& r, float maxDist, float& intervalMin, float& intervalMax) const
+    {
+        intervalMin = -1.f;
+        intervalMax = -1.f;
+        G3D::Vector3 const& org = r.origin();
+        G3D::Vector3 const& dir = r.direction();
+        for (int i = 0; i < 3; ++i)
+        {
+            if (G3D::fuzzyNe(dir[i], 0.0f))
+            {
+                float invDir = 1.f / dir[i];
+                float t1 = (bounds.low()[i]  - org[i]) * invDir;
+                float t2 = (bounds.high()[i] - org[i]) * invDir;
+                if (t1 > t2)
+                {
+                    std::swap(t1, t2);
+                }
+                if (t1 > intervalMin)
+                {
+                    intervalMin = t1;
+                }
+                if (t2 < intervalMax || intervalMax < 0.f)
+                {
+                    intervalMax = t2;
+                }
+                if (intervalMax <= 0 || intervalMin >= maxDist)
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (intervalMin > intervalMax)
+        {
+            return false;
+        }
+        intervalMin = std::max(intervalMin, 0.f);
+        intervalMax = std::min(intervalMax, maxDist);
+        return true;
+    }
 
     class BuildStats
     {
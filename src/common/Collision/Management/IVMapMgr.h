@@ -73,6 +73,14 @@ namespace VMAP
         Optional<LiquidInfo> liquidInfo;
     };
 
+    // One segment of a batched line of sight query, in world coordinates
+    struct LineOfSightQuery
+    {
+        float x1, y1, z1;
+        float x2, y2, z2;
+        bool InLineOfSight = true;
+    };
+
     //===========================================================
     class IVMapMgr
     {
@@ -20,6 +20,7 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <cstring>
 
 namespace MMAP
 {
@@ -147,49 +148,83 @@ namespace MMAP
 
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId, x, y);
-        FILE* file = fopen(fileName.c_str(), "rb");
-        if (!file)
-        {
-            LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
-            return false;
-        }
-
-        // read header
         MmapTileHeader fileHeader;
-        if (fread(&fileHeader, sizeof(MmapTileHeader), 1, file) != 1 || fileHeader.mmapMagic != MMAP_MAGIC)
-        {
-            LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
-            return false;
-        }
+        unsigned char* data = nullptr;
+        int tileFlags = DT_TILE_FREE_DATA;
+        std::unique_ptr<Acore::MappedFile> mappedTile;
 
-        if (fileHeader.mmapVersion != MMAP_VERSION)
+        if (sConfigMgr->GetOption<bool>("DataDir.MemoryMapped", false))
         {
-            LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
-                           mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
-            fclose(file);
-            return false;
-        }
+            // The tile is used in place. Detour writes the poly links into the tile data, those pages
+            // become private on first write while vertices, detail meshes and the BV tree stay shared.
+            mappedTile = Acore::MappedFile::Open(fileName, Acore::MappedFile::Access::CopyOnWrite);
+            if (!mappedTile)
+            {
+                LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
+                return false;
+            }
+
+            if (mappedTile->GetSize() < sizeof(MmapTileHeader))
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+                return false;
+            }
+
+            memcpy(&fileHeader, mappedTile->GetData(), sizeof(MmapTileHeader));
+            if (!IsValidTileHeader(fileHeader, mapId, x, y))
+                return false;
 
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
+            if (mappedTile->GetSize() - sizeof(MmapTileHeader) < fileHeader.size)
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+                return false;
+            }
 
-        std::size_t result = fread(data, fileHeader.size, 1, file);
-        if (!result)
+            data = mappedTile->GetWritableData() + sizeof(MmapTileHeader);
+            tileFlags = 0;
+        }
+        else
         {
-            LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            FILE* file = fopen(fileName.c_str(), "rb");
+            if (!file)
+            {
+                LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
+                return false;
+            }
+
+            // read header
+            if (fread(&fileHeader, sizeof(MmapTileHeader), 1, file) != 1 || !IsValidTileHeader(fileHeader, mapId, x, y))
+            {
+                fclose(file);
+                return false;
+            }
+
+            data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
+            ASSERT(data);
+
+            std::size_t result = fread(data, fileHeader.size, 1, file);
+            if (!result)
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+                fclose(file);
+                dtFree(data);
+                return false;
+            }
+
             fclose(file);
-            return false;
         }
 
-        fclose(file);
-
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        // mapped tiles are not owned by detour, the mapping is released in unloadMap instead
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, tileFlags, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            if (mappedTile)
+                mmap->mappedTiles[packedGridPos] = std::move(mappedTile);
+
+            ++mmap->tileGeneration;
             ++loadedTiles;
             dtMeshHeader* header = (dtMeshHeader*)data;
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
@@ -197,10 +232,30 @@ namespace MMAP
         }
 
         LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-        dtFree(data);
+        if (!mappedTile)
+            dtFree(data);
+
         return false;
     }
 
+    bool MMapMgr::IsValidTileHeader(MmapTileHeader const& fileHeader, uint32 mapId, int32 x, int32 y)
+    {
+        if (fileHeader.mmapMagic != MMAP_MAGIC)
+        {
+            LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        if (fileHeader.mmapVersion != MMAP_VERSION)
+        {
+            LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
+                           mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
+            return false;
+        }
+
+        return true;
+    }
+
     bool MMapMgr::unloadMap(uint32 mapId, int32 x, int32 y)
     {
         // check if we have this map loaded
@@ -236,6 +291,8 @@ namespace MMAP
         }
 
         mmap->loadedTileRefs.erase(packedGridPos);
+        mmap->mappedTiles.erase(packedGridPos);
+        ++mmap->tileGeneration;
         --loadedTiles;
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02},{:02}] from {:03}", mapId, x, y, mapId);
         return true;
@@ -314,6 +371,17 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    uint32 MMapMgr::GetTileGeneration(uint32 mapId) const
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return 0;
+        }
+
+        return itr->second->tileGeneration;
+    }
+
     dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -22,6 +22,9 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include "MappedFile.h"
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -36,6 +39,8 @@ inline void dtCustomFree(void* ptr)
     delete [] (unsigned char*)ptr;
 }
 
+struct MmapTileHeader;
+
 //  move map related classes
 namespace MMAP
 {
@@ -64,6 +69,8 @@ namespace MMAP
         NavMeshQuerySet navMeshQueries; // instanceId to query
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        std::unordered_map<uint32, std::unique_ptr<Acore::MappedFile>> mappedTiles; // backing files of tiles used in place, must outlive navMesh
+        std::atomic<uint32> tileGeneration{0}; // bumped whenever a tile is added or removed, invalidates cached poly refs
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
@@ -85,6 +92,7 @@ namespace MMAP
         // the returned [dtNavMeshQuery const*] is NOT threadsafe
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
+        [[nodiscard]] uint32 GetTileGeneration(uint32 mapId) const;
 
         [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
         [[nodiscard]] uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
@@ -92,6 +100,7 @@ namespace MMAP
     private:
         bool loadMapData(uint32 mapId);
         uint32 packTileID(int32 x, int32 y);
+        static bool IsValidTileHeader(MmapTileHeader const& fileHeader, uint32 mapId, int32 x, int32 y);
         [[nodiscard]] MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
 
         MMapDataSet loadedMMaps;
@@ -24,6 +24,7 @@
 #include "WorldModel.h"
 #include <G3D/Vector3.h>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -194,6 +195,69 @@ namespace VMAP
         return true;
     }
 
+    void VMapMgr2::isInLineOfSight(unsigned int mapId, LineOfSightQuery* queries, std::size_t count, ModelIgnoreFlags ignoreFlags)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            queries[i].InLineOfSight = true;
+        }
+
+#if defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+        {
+            return;
+        }
+#endif
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return;
+        }
+
+        std::vector<Vector3> starts;
+        std::vector<Vector3> ends;
+        std::vector<uint32> indices;
+        starts.reserve(count);
+        ends.reserve(count);
+        indices.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            LineOfSightQuery const& query = queries[i];
+            Vector3 pos1 = convertPositionToInternalRep(query.x1, query.y1, query.z1);
+            Vector3 pos2 = convertPositionToInternalRep(query.x2, query.y2, query.z2);
+            if (pos1 != pos2)
+            {
+                starts.push_back(pos1);
+                ends.push_back(pos2);
+                indices.push_back(uint32(i));
+            }
+        }
+
+        if (indices.empty())
+        {
+            return;
+        }
+
+        std::unique_ptr<bool[]> results = std::make_unique<bool[]>(indices.size());
+        instanceTree->second->isInLineOfSight(starts.data(), ends.data(), results.get(), uint32(indices.size()), ignoreFlags);
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+            queries[indices[i]].InLineOfSight = results[i];
+        }
+    }
+
+    uint32 VMapMgr2::GetTileGeneration(unsigned int mapId) const
+    {
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return 0;
+        }
+
+        return instanceTree->second->getTileGeneration();
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
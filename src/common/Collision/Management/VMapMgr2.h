@@ -107,6 +107,10 @@ namespace VMAP
         void unloadMap(unsigned int mapId) override;
 
         bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
+        // answers all queries of one map in one pass, rays are traced in packets through the map tree
+        void isInLineOfSight(unsigned int mapId, LineOfSightQuery* queries, std::size_t count, ModelIgnoreFlags ignoreFlags);
+        // changes whenever geometry is loaded into or removed from the map, 0 if the map has no tree
+        [[nodiscard]] uint32 GetTileGeneration(unsigned int mapId) const;
         /**
         fill the hit pos and return true, if an object was hit
         */
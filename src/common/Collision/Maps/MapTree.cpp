@@ -31,6 +31,11 @@ using G3D::Vector3;
 
 namespace VMAP
 {
+    namespace
+    {
+        std::atomic<uint32> NextTileGeneration{0};
+    }
+
     class MapRayCallback
     {
     public:
@@ -123,7 +128,7 @@ namespace VMAP
     }
 
     StaticMapTree::StaticMapTree(uint32 mapID, const std::string& basePath)
-        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath)
+        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath), iTileGeneration(++NextTileGeneration)
     {
         if (iBasePath.length() > 0 && iBasePath[iBasePath.length() - 1] != '/' && iBasePath[iBasePath.length() - 1] != '\\')
         {
@@ -178,6 +183,55 @@ namespace VMAP
 
         return !GetIntersectionTime(ray, maxDist, true, ignoreFlags);
     }
+
+    void StaticMapTree::isInLineOfSight(const Vector3* starts, const Vector3* ends, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) const
+    {
+        MapRayCallback intersectionCallBack(iTreeValues, ignoreFlags);
+        G3D::Ray rays[BIH::RAY_PACKET_SIZE];
+        float maxDists[BIH::RAY_PACKET_SIZE];
+        uint32 indices[BIH::RAY_PACKET_SIZE];
+        uint32 packetSize = 0;
+
+        auto tracePacket = [&]()
+        {
+            uint32 hitMask = iTree.intersectRayPacket(rays, maxDists, packetSize, intersectionCallBack);
+            for (uint32 i = 0; i < packetSize; ++i)
+            {
+                results[indices[i]] = !(hitMask & (1 << i));
+            }
+            packetSize = 0;
+        };
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            // same special cases as the single segment version
+            float maxDist = (ends[i] - starts[i]).magnitude();
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                results[i] = false;
+                continue;
+            }
+
+            if (maxDist < 1e-10f)
+            {
+                results[i] = true;
+                continue;
+            }
+
+            rays[packetSize] = G3D::Ray::fromOriginAndDirection(starts[i], (ends[i] - starts[i]) / maxDist);
+            maxDists[packetSize] = maxDist;
+            indices[packetSize] = i;
+            if (++packetSize == BIH::RAY_PACKET_SIZE)
+            {
+                tracePacket();
+            }
+        }
+
+        if (packetSize)
+        {
+            tracePacket();
+        }
+    }
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
@@ -356,6 +410,7 @@ namespace VMAP
         }
         iLoadedSpawns.clear();
         iLoadedTiles.clear();
+        iTileGeneration = ++NextTileGeneration;
     }
 
     //=========================================================
@@ -444,6 +499,7 @@ namespace VMAP
                 }
             }
             iLoadedTiles[packTileID(tileX, tileY)] = true;
+            iTileGeneration = ++NextTileGeneration;
             fclose(tf);
         }
         else
@@ -518,6 +574,7 @@ namespace VMAP
                 }
                 fclose(tf);
             }
+            iTileGeneration = ++NextTileGeneration;
         }
         iLoadedTiles.erase(tile);
 
@@ -20,6 +20,7 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include <atomic>
 #include <unordered_map>
 
 namespace VMAP
@@ -57,6 +58,8 @@ namespace VMAP
         // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
         loadedSpawnMap iLoadedSpawns;
         std::string iBasePath;
+        // unique over all trees, changes whenever a tile is loaded or unloaded
+        std::atomic<uint32> iTileGeneration;
 
     private:
         bool GetIntersectionTime(const G3D::Ray& pRay, float& pMaxDist, bool StopAtFirstHit, ModelIgnoreFlags ignoreFlags) const;
@@ -71,6 +74,8 @@ namespace VMAP
         ~StaticMapTree();
 
         [[nodiscard]] bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+        // traces the segments in packets of BIH::RAY_PACKET_SIZE, results[i] is true if nothing is hit between starts[i] and ends[i]
+        void isInLineOfSight(const G3D::Vector3* starts, const G3D::Vector3* ends, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) const;
         bool GetObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
         [[nodiscard]] float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
         bool GetAreaInfo(G3D::Vector3& pos, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const;
@@ -82,6 +87,7 @@ namespace VMAP
         void UnloadMapTile(uint32 tileX, uint32 tileY, VMapMgr2* vm);
         [[nodiscard]] bool isTiled() const { return iIsTiled; }
         [[nodiscard]] uint32 numLoadedTiles() const { return iLoadedTiles.size(); }
+        [[nodiscard]] uint32 getTileGeneration() const { return iTileGeneration; }
         void GetModelInstances(ModelInstance*& models, uint32& count);
     };
 
@@ -17,6 +17,7 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include "MappedFile.h"
 #include <string.h>
 
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
@@ -26,8 +27,17 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
     uint32 header;
     if (data)
     {
-        delete [] data;
+        if (!mappedFile)
+            delete [] data;
+
         data = nullptr;
+        mappedFile.reset();
+    }
+
+    // records are only read while building the storage, so they can stay in the page cache
+    if (std::unique_ptr<Acore::MappedFile> file = Acore::MappedFile::Open(filename))
+    {
+        return LoadMapped(std::move(file), fmt);
     }
 
     FILE* f = fopen(filename, "rb");
@@ -82,6 +92,65 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
 
     EndianConvert(stringSize);
 
+    InitFieldOffsets(fmt);
+
+    data = new unsigned char[recordSize * recordCount + stringSize];
+    stringTable = data + recordSize * recordCount;
+
+    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+    {
+        fclose(f);
+        return false;
+    }
+
+    fclose(f);
+
+    return true;
+}
+
+bool DBCFileLoader::LoadMapped(std::unique_ptr<Acore::MappedFile> file, char const* fmt)
+{
+    constexpr std::size_t HeaderSize = 5 * sizeof(uint32);
+    if (file->GetSize() < HeaderSize)
+    {
+        return false;
+    }
+
+    uint32 header[5];
+    memcpy(header, file->GetData(), HeaderSize);
+    for (uint32& value : header)
+    {
+        EndianConvert(value);
+    }
+
+    if (header[0] != 0x43424457)                             //'WDBC'
+    {
+        return false;
+    }
+
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
+
+    // a truncated file would otherwise be read past the end of the mapping
+    if (HeaderSize + uint64(recordSize) * recordCount + stringSize > file->GetSize())
+    {
+        return false;
+    }
+
+    InitFieldOffsets(fmt);
+
+    // never written to, AutoProduceData and AutoProduceStrings copy everything they keep
+    data = const_cast<unsigned char*>(file->GetData() + HeaderSize);
+    stringTable = data + recordSize * recordCount;
+    mappedFile = std::move(file);
+    return true;
+}
+
+void DBCFileLoader::InitFieldOffsets(char const* fmt)
+{
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -97,24 +166,12 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
         }
     }
-
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
-    return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    if (!mappedFile)
+        delete[] data;
 
     delete[] fieldsOffset;
 }
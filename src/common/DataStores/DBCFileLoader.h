@@ -21,6 +21,12 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
+
+namespace Acore
+{
+    class MappedFile;
+}
 
 enum DbcFieldFormat
 {
@@ -97,6 +103,9 @@ public:
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
 private:
+    bool LoadMapped(std::unique_ptr<Acore::MappedFile> file, char const* fmt);
+    void InitFieldOffsets(char const* fmt);
+
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
@@ -104,6 +113,8 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    // records and strings are read in place from the mapping when set, data points into it then
+    std::unique_ptr<Acore::MappedFile> mappedFile;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
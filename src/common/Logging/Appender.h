@@ -19,6 +19,7 @@
 #define APPENDER_H
 
 #include "Define.h"
+#include "Duration.h"
 #include "LogCommon.h"
 #include <stdexcept>
 #include <string>
@@ -42,6 +43,12 @@ public:
     static char const* getLogLevelString(LogLevel level);
     virtual void setRealmId(uint32 /*realmId*/) { }
 
+    // Appenders that do not need the formatted text get the format string and arguments instead
+    virtual bool WritesText() const { return true; }
+
+    // Called by the logging thread after each write pass, appenders holding messages back write them once due
+    virtual void Update(Seconds /*now*/) { }
+
 private:
     virtual void _write(LogMessage const* /*message*/) = 0;
 
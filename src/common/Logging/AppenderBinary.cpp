@@ -0,0 +1,102 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AppenderBinary.h"
+#include "Log.h"
+#include "LogMessage.h"
+#include "StringConvert.h"
+
+namespace
+{
+    // Records are written in blocks of about this size, or once the flush interval passed
+    constexpr std::size_t BlockSize = 64 * 1024;
+}
+
+AppenderBinary::AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args) :
+    Appender(id, name, level, flags),
+    _logfile(nullptr),
+    _writer(5 < args.size() && Acore::StringTo<bool>(args[5]).value_or(false)),
+    _flushInterval(6 < args.size() ? Seconds(Acore::StringTo<uint32>(args[6]).value_or(1)) : 1s),
+    _lastFlush(0s)
+{
+    if (args.size() < 4)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormat("Log::CreateAppenderFromConfig: Missing file name for appender {}", name));
+    }
+
+    std::string fileName(args[3]);
+    if (flags & APPENDER_FLAGS_USE_TIMESTAMP)
+    {
+        std::size_t dot_pos = fileName.find_last_of('.');
+        if (dot_pos != std::string::npos)
+        {
+            fileName.insert(dot_pos, sLog->GetLogsTimestamp());
+        }
+        else
+        {
+            fileName += sLog->GetLogsTimestamp();
+        }
+    }
+
+    std::string mode = (4 < args.size() && args[4] == "w") ? "wb" : "ab";
+    _logfile = fopen((sLog->GetLogsDir() + fileName).c_str(), mode.c_str());
+    if (!_logfile)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormat("Log::CreateAppenderFromConfig: Can not open {} for appender {}", fileName, name));
+    }
+
+    // Every opening starts a stream of its own, so appending to an older file keeps it readable
+    _writer.Start(_buffer);
+}
+
+AppenderBinary::~AppenderBinary()
+{
+    Flush();
+    fclose(_logfile);
+}
+
+void AppenderBinary::_write(LogMessage const* message)
+{
+    _writer.Add(*message);
+
+    if (_writer.GetPendingSize() >= BlockSize || message->mtime - _lastFlush >= _flushInterval)
+    {
+        Flush();
+        _lastFlush = message->mtime;
+    }
+}
+
+void AppenderBinary::Update(Seconds now)
+{
+    // Without later messages the block would wait for the next one, however long that takes
+    if (_writer.GetPendingSize() && now - _lastFlush >= _flushInterval)
+    {
+        Flush();
+        _lastFlush = now;
+    }
+}
+
+void AppenderBinary::Flush()
+{
+    _writer.Flush(_buffer);
+    if (_buffer.empty())
+        return;
+
+    fwrite(_buffer.data(), 1, _buffer.size(), _logfile);
+    fflush(_logfile);
+    _buffer.clear();
+}
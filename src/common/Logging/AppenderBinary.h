@@ -0,0 +1,48 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef APPENDERBINARY_H
+#define APPENDERBINARY_H
+
+#include "Appender.h"
+#include "BinaryLog.h"
+#include <vector>
+
+// Writes messages in the binary format of BinaryLog.h, the logdecoder tool turns the file back into text
+class AppenderBinary : public Appender
+{
+public:
+    static constexpr AppenderType type = APPENDER_BINARY;
+
+    AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args);
+    ~AppenderBinary();
+    AppenderType getType() const override { return type; }
+    bool WritesText() const override { return false; }
+    void Update(Seconds now) override;
+
+private:
+    void _write(LogMessage const* message) override;
+    void Flush();
+
+    FILE* _logfile;
+    Acore::BinaryLog::Writer _writer;
+    std::string _buffer;
+    Seconds _flushInterval;
+    Seconds _lastFlush;
+};
+
+#endif
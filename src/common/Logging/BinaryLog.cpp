@@ -0,0 +1,277 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryLog.h"
+#include "LogArguments.h"
+#include "LogMessage.h"
+#include <zlib.h>
+
+using Acore::LogArguments::AppendVarint;
+using Acore::LogArguments::ReadVarint;
+
+namespace
+{
+    constexpr char StreamMagic[4] = { 'A', 'C', 'B', 'L' };
+    constexpr uint8 StreamVersion = 1;
+
+    constexpr uint8 ChunkBlock = 0;
+
+    constexpr uint8 RecordString = 1;
+    constexpr uint8 RecordMessage = 2;
+
+    // Formats built at runtime would grow the table without bound, past this many strings are written inline
+    constexpr std::size_t MaxInternedStrings = 16384;
+
+    // Far above what the appender writes at once, anything larger is damaged data
+    constexpr uint64 MaxBlockSize = 64 * 1024 * 1024;
+
+    void AppendString(std::string& out, std::string_view value)
+    {
+        AppendVarint(out, value.size());
+        out.append(value);
+    }
+
+    bool ReadString(std::string_view& in, std::string_view& value)
+    {
+        uint64 length;
+        if (!ReadVarint(in, length) || in.size() < length)
+            return false;
+
+        value = in.substr(0, length);
+        in.remove_prefix(length);
+        return true;
+    }
+}
+
+void Acore::BinaryLog::Writer::Start(std::string& out)
+{
+    out.append(StreamMagic, sizeof(StreamMagic));
+    out.push_back(char(StreamVersion));
+
+    _block.clear();
+    _strings.clear();
+    _lastTime = 0s;
+}
+
+void Acore::BinaryLog::Writer::Add(LogMessage const& message)
+{
+    // New strings are defined in front of the first message using them
+    uint64 const typeRef = Intern(message.type);
+    uint64 const formatRef = message.format.empty() ? 0 : Intern(message.format);
+
+    int64 const delta = (message.mtime - _lastTime).count();
+    _lastTime = message.mtime;
+
+    _block.push_back(char(RecordMessage));
+    _block.push_back(char(message.level));
+    AppendRef(typeRef, message.type);
+    AppendVarint(_block, (uint64(delta) << 1) ^ uint64(delta >> 63));
+
+    if (!message.format.empty())
+    {
+        _block.push_back(1);
+        AppendRef(formatRef, message.format);
+        AppendString(_block, message.arguments);
+    }
+    else
+    {
+        _block.push_back(0);
+        AppendString(_block, message.text);
+    }
+
+    AppendString(_block, message.param1);
+}
+
+void Acore::BinaryLog::Writer::Flush(std::string& out)
+{
+    if (_block.empty())
+        return;
+
+    out.push_back(char(ChunkBlock));
+    AppendVarint(out, _block.size());
+
+    if (_compress)
+    {
+        uLongf size = compressBound(_block.size());
+        _compressed.resize(size);
+        if (compress2(reinterpret_cast<Bytef*>(_compressed.data()), &size, reinterpret_cast<Bytef const*>(_block.data()), _block.size(), Z_BEST_SPEED) == Z_OK
+            && size < _block.size())
+        {
+            AppendVarint(out, size);
+            out.append(_compressed.data(), size);
+            _block.clear();
+            return;
+        }
+    }
+
+    AppendVarint(out, 0);
+    out.append(_block);
+    _block.clear();
+}
+
+uint64 Acore::BinaryLog::Writer::Intern(std::string_view value)
+{
+    auto itr = _strings.find(value);
+    if (itr != _strings.end())
+        return itr->second + 1;
+
+    if (_strings.size() >= MaxInternedStrings)
+        return 0;
+
+    uint32 const id = _strings.size();
+    _strings.emplace(std::string(value), id);
+
+    _block.push_back(char(RecordString));
+    AppendString(_block, value);
+    return id + 1;
+}
+
+void Acore::BinaryLog::Writer::AppendRef(uint64 ref, std::string_view value)
+{
+    AppendVarint(_block, ref);
+    if (!ref)
+        AppendString(_block, value);
+}
+
+std::string Acore::BinaryLog::Record::GetText() const
+{
+    if (Format.empty())
+        return std::string(Text);
+
+    return Acore::LogArguments::Format(Format, Arguments);
+}
+
+bool Acore::BinaryLog::Reader::Next(Record& record)
+{
+    while (true)
+    {
+        if (_records.empty() && !NextBlock())
+            return false;
+
+        uint8 const kind = _records.front();
+        _records.remove_prefix(1);
+
+        if (kind == RecordString)
+        {
+            std::string_view value;
+            if (!ReadString(_records, value))
+                return Damaged();
+
+            _strings.emplace_back(value);
+            continue;
+        }
+
+        if (kind != RecordMessage || _records.empty())
+            return Damaged();
+
+        record.Level = LogLevel(uint8(_records.front()));
+        _records.remove_prefix(1);
+
+        uint64 delta;
+        if (!ReadRef(record.Type) || !ReadVarint(_records, delta) || _records.empty())
+            return Damaged();
+
+        _time += Seconds(int64(delta >> 1) ^ -int64(delta & 1));
+        record.Time = _time;
+
+        bool const formatted = _records.front() != 0;
+        _records.remove_prefix(1);
+
+        record.Format = {};
+        record.Arguments = {};
+        record.Text = {};
+        if (formatted ? !ReadRef(record.Format) || !ReadString(_records, record.Arguments) : !ReadString(_records, record.Text))
+            return Damaged();
+
+        if (!ReadString(_records, record.Param1))
+            return Damaged();
+
+        return true;
+    }
+}
+
+bool Acore::BinaryLog::Reader::NextBlock()
+{
+    while (!_data.empty())
+    {
+        if (_data.starts_with(std::string_view(StreamMagic, sizeof(StreamMagic))))
+        {
+            _data.remove_prefix(sizeof(StreamMagic));
+            if (_data.empty() || uint8(_data.front()) != StreamVersion)
+                return Damaged();
+
+            _data.remove_prefix(1);
+            _strings.clear();
+            _time = 0s;
+            continue;
+        }
+
+        if (uint8(_data.front()) != ChunkBlock)
+            return Damaged();
+
+        _data.remove_prefix(1);
+
+        uint64 rawSize, storedSize;
+        if (!ReadVarint(_data, rawSize) || !ReadVarint(_data, storedSize) || rawSize > MaxBlockSize)
+            return Damaged();
+
+        uint64 const size = storedSize ? storedSize : rawSize;
+        if (_data.size() < size)
+            return Damaged();
+
+        if (storedSize)
+        {
+            _block.resize(rawSize);
+            uLongf length = rawSize;
+            if (uncompress(reinterpret_cast<Bytef*>(_block.data()), &length, reinterpret_cast<Bytef const*>(_data.data()), storedSize) != Z_OK || length != rawSize)
+                return Damaged();
+        }
+        else
+            _block.assign(_data.substr(0, rawSize));
+
+        _data.remove_prefix(size);
+        _records = _block;
+        if (!_records.empty())
+            return true;
+    }
+
+    return false;
+}
+
+bool Acore::BinaryLog::Reader::ReadRef(std::string_view& value)
+{
+    uint64 ref;
+    if (!ReadVarint(_records, ref))
+        return false;
+
+    if (!ref)
+        return ReadString(_records, value);
+
+    if (ref > _strings.size())
+        return false;
+
+    value = _strings[ref - 1];
+    return true;
+}
+
+bool Acore::BinaryLog::Reader::Damaged()
+{
+    _damaged = true;
+    _data = {};
+    _records = {};
+    return false;
+}
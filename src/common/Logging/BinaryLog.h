@@ -0,0 +1,120 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BINARY_LOG_H
+#define _BINARY_LOG_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "LogCommon.h"
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct LogMessage;
+
+/*
+    Binary log file layout:
+
+    stream: "ACBL", uint8 version, followed by blocks. Appending to a file starts a new stream.
+    block:  uint8 0, varint raw size, varint stored size (0 = not compressed), stored bytes (zlib)
+
+    The records of a block:
+    string:  uint8 1, varint length, bytes. Gets the next id of the stream, starting at 0.
+    message: uint8 2, uint8 level, ref type, zigzag varint seconds since the previous message,
+             uint8 formatted, formatted ? (ref format, varint length, arguments) : (varint length, text),
+             varint length, param1
+    ref:     varint, 0 = varint length and bytes follow, otherwise the id of a string + 1
+
+    Arguments are encoded by Acore::LogArguments.
+*/
+namespace Acore::BinaryLog
+{
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view value) const { return std::hash<std::string_view>()(value); }
+    };
+
+    class AC_COMMON_API Writer
+    {
+    public:
+        explicit Writer(bool compress) : _compress(compress) { }
+
+        //! Appends the header of a new stream to out
+        void Start(std::string& out);
+
+        void Add(LogMessage const& message);
+
+        //! Size of the records added since the last Flush
+        [[nodiscard]] std::size_t GetPendingSize() const { return _block.size(); }
+
+        //! Appends the records added since the last Flush to out as one block
+        void Flush(std::string& out);
+
+    private:
+        uint64 Intern(std::string_view value);
+        void AppendRef(uint64 ref, std::string_view value);
+
+        bool _compress;
+        std::string _block;
+        std::string _compressed;
+        std::unordered_map<std::string, uint32, StringHash, std::equal_to<>> _strings;
+        Seconds _lastTime = 0s;
+    };
+
+    struct Record
+    {
+        LogLevel Level = LOG_LEVEL_DISABLED;
+        Seconds Time = 0s;
+        std::string_view Type;
+        std::string_view Format;        // empty if the message was written as text
+        std::string_view Arguments;
+        std::string_view Text;
+        std::string_view Param1;
+
+        [[nodiscard]] std::string GetText() const;
+    };
+
+    class AC_COMMON_API Reader
+    {
+    public:
+        explicit Reader(std::string_view data) : _data(data) { }
+
+        //! Reads the next message, the views of the record stay valid until the next call
+        bool Next(Record& record);
+
+        //! True if reading stopped at data that is no binary log
+        [[nodiscard]] bool IsDamaged() const { return _damaged; }
+
+    private:
+        bool NextBlock();
+        bool ReadRef(std::string_view& value);
+        bool Damaged();
+
+        std::string_view _data;
+        std::string _block;
+        std::string_view _records;
+        std::deque<std::string> _strings;
+        Seconds _time = 0s;
+        bool _damaged = false;
+    };
+}
+
+#endif
@@ -16,30 +16,94 @@
  */
 
 #include "Log.h"
+#include "AppenderBinary.h"
 #include "AppenderConsole.h"
 #include "AppenderFile.h"
 #include "Config.h"
 #include "Errors.h"
-#include "IoContext.h"
+#include "LogArguments.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
 #include "Logger.h"
-#include "Strand.h"
+#include "SPSCRingBuffer.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
+#include <algorithm>
 #include <chrono>
+#include <map>
 #include <memory>
 
+// A message of a thread waiting for the logging thread, which also formats it
+struct LogRecord
+{
+    LogLevel Level = LOG_LEVEL_DISABLED;
+    std::string Type;
+    std::string Format;
+    std::string Arguments;
+    std::string Param1;
+    Seconds Time = 0s;
+    TimePoint Queued;
+};
+
+struct LogThreadBuffer
+{
+    explicit LogThreadBuffer(std::size_t capacity) : Records(capacity) { }
+
+    Acore::SPSCRingBuffer<LogRecord> Records;
+    std::atomic<uint64> Dropped{0};
+    std::atomic<bool> Abandoned{false};         // the owning thread exited
+};
+
+namespace
+{
+    // How long the logging thread waits before writing if no buffer filled up to half
+    constexpr Milliseconds LogWriteInterval = 10ms;
+
+    struct ThreadBufferHolder
+    {
+        ~ThreadBufferHolder()
+        {
+            if (Buffer)
+                Buffer->Abandoned = true;
+        }
+
+        std::shared_ptr<LogThreadBuffer> Buffer;
+    };
+
+    thread_local ThreadBufferHolder ThreadBuffer;
+
+    struct CachedLoggers
+    {
+        uint32 Generation = 0;
+        std::map<std::string, Logger const*, std::less<>> Loggers;
+    };
+
+    thread_local CachedLoggers ThreadLoggers;
+
+    std::string FormatMessage(fmt::string_view format, fmt::format_args args)
+    {
+        try
+        {
+            return fmt::vformat(format, args);
+        }
+        catch (std::exception const& e)
+        {
+            return Acore::StringFormat("Wrong format occurred ({}). Fmt string: '{}'", e.what(), std::string_view(format.data(), format.size()));
+        }
+    }
+}
+
 Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
     RegisterAppender<AppenderFile>();
+    RegisterAppender<AppenderBinary>();
 }
 
 Log::~Log()
 {
+    SetSynchronous();
     Close();
 }
 
@@ -228,27 +292,146 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
     appenderFactory[index] = appenderCreateFn;
 }
 
-void Log::_outMessage(std::string const& filter, LogLevel level, std::string_view message)
+void Log::_outMessage(std::string_view filter, LogLevel level, fmt::string_view format, fmt::format_args args, std::string_view param1)
+{
+    if (_async.load(std::memory_order_relaxed))
+    {
+        _enqueueMessage(filter, level, format, args, param1);
+        return;
+    }
+
+    Logger const* logger = GetCachedLoggerByType(filter);
+    if (!logger)
+        return;
+
+    LogMessage message(level, std::string(filter), {}, param1);
+
+    // Binary appenders write the format string and arguments, formatting is only paid for text
+    if (logger->HasBinaryAppenders())
+    {
+        message.format.assign(format.data(), format.size());
+        Acore::LogArguments::Encode(message.arguments, args);
+    }
+
+    if (logger->HasTextAppenders())
+        message.text = FormatMessage(format, args);
+
+    logger->write(&message);
+}
+
+void Log::_enqueueMessage(std::string_view filter, LogLevel level, fmt::string_view format, fmt::format_args args, std::string_view param1)
+{
+    LogThreadBuffer& buffer = GetThreadBuffer();
+
+    bool const pushed = buffer.Records.Push([&](LogRecord& record)
+    {
+        record.Level = level;
+        record.Type.assign(filter);
+        record.Param1.assign(param1);
+        record.Time = GetEpochTime();
+        record.Queued = std::chrono::steady_clock::now();
+        record.Format.assign(format.data(), format.size());
+        record.Arguments.clear();
+        Acore::LogArguments::Encode(record.Arguments, args);
+    });
+
+    if (!pushed)
+    {
+        buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (buffer.Records.Size() * 2 >= buffer.Records.Capacity())
+        _wakeUp.notify_one();
+}
+
+LogThreadBuffer& Log::GetThreadBuffer()
 {
-    write(std::make_unique<LogMessage>(level, filter, message));
+    if (!ThreadBuffer.Buffer)
+    {
+        ThreadBuffer.Buffer = std::make_shared<LogThreadBuffer>(_bufferSize);
+
+        std::lock_guard<std::mutex> guard(_buffersLock);
+        _buffers.push_back(ThreadBuffer.Buffer);
+    }
+
+    return *ThreadBuffer.Buffer;
 }
 
-void Log::_outCommand(std::string_view message, std::string_view param1)
+void Log::LogThread()
 {
-    write(std::make_unique<LogMessage>(LOG_LEVEL_INFO, "commands.gm", message, param1));
+    while (!_stopThread)
+    {
+        {
+            std::unique_lock<std::mutex> guard(_wakeUpLock);
+            _wakeUp.wait_for(guard, LogWriteInterval, [this]() { return _stopThread.load(); });
+        }
+
+        WriteBuffered();
+    }
+
+    WriteBuffered();
 }
 
-void Log::write(std::unique_ptr<LogMessage>&& msg) const
+void Log::WriteBuffered()
 {
-    Logger const* logger = GetLoggerByType(msg->type);
+    std::vector<std::shared_ptr<LogThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> guard(_buffersLock);
+
+        // Threads that exited can not add records anymore, their buffer is done once it was written
+        std::erase_if(_buffers, [](std::shared_ptr<LogThreadBuffer> const& buffer)
+        {
+            return buffer->Abandoned && !buffer->Records.Size();
+        });
 
-    if (_ioContext)
+        buffers = _buffers;
+    }
+
+    std::vector<std::pair<TimePoint, std::unique_ptr<LogMessage>>> messages;
+    uint64 dropped = 0;
+    for (std::shared_ptr<LogThreadBuffer> const& buffer : buffers)
     {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
+        buffer->Records.Consume([&](LogRecord const& record)
+        {
+            std::unique_ptr<LogMessage> message = std::make_unique<LogMessage>(record.Level, record.Type, std::string_view(), record.Param1);
+            message->mtime = record.Time;
+            message->format = record.Format;
+            message->arguments = record.Arguments;
+            messages.emplace_back(record.Queued, std::move(message));
+        });
+
+        dropped += buffer->Dropped.exchange(0, std::memory_order_relaxed);
     }
-    else
-        logger->write(msg.get());
+
+    // Messages of different threads are written in the order they were logged
+    std::stable_sort(messages.begin(), messages.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
+
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
+    for (auto const& [queued, message] : messages)
+    {
+        Logger const* logger = GetLoggerByType(message->type);
+        if (!logger)
+            continue;
+
+        if (logger->HasTextAppenders())
+            message->text = Acore::LogArguments::Format(message->format, message->arguments);
+
+        logger->write(message.get());
+    }
+
+    if (dropped)
+    {
+        _droppedMessages += dropped;
+
+        LogMessage message(LOG_LEVEL_ERROR, "server", Acore::StringFormat("Log buffer of a thread was full, {} message(s) dropped. Consider raising Log.Async.BufferSize.", dropped));
+        if (Logger const* logger = GetLoggerByType("server"))
+            logger->write(&message);
+    }
+
+    Seconds const now = GetEpochTime();
+    for (auto const& [id, appender] : appenders)
+        appender->Update(now);
 }
 
 Logger const* Log::GetLoggerByType(std::string const& type) const
@@ -274,6 +457,22 @@ Logger const* Log::GetLoggerByType(std::string const& type) const
     return GetLoggerByType(parentLogger);
 }
 
+Logger const* Log::GetCachedLoggerByType(std::string_view type) const
+{
+    uint32 const generation = _loggersGeneration.load(std::memory_order_acquire);
+    if (ThreadLoggers.Generation != generation)
+    {
+        ThreadLoggers.Loggers.clear();
+        ThreadLoggers.Generation = generation;
+    }
+
+    auto itr = ThreadLoggers.Loggers.find(type);
+    if (itr == ThreadLoggers.Loggers.end())
+        itr = ThreadLoggers.Loggers.emplace(std::string(type), GetLoggerByType(std::string(type))).first;
+
+    return itr->second;
+}
+
 std::string Log::GetTimestampStr()
 {
     return Acore::Time::TimeToTimestampStr(GetEpochTime(), "%Y-%m-%d_%H_%M_%S");
@@ -288,6 +487,7 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
 
     LogLevel newLevel = LogLevel(newLeveli);
 
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
     if (isLogger)
     {
         auto it = loggers.begin();
@@ -324,6 +524,7 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
 
 void Log::SetRealmId(uint32 id)
 {
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
     for (std::pair<uint8 const, std::unique_ptr<Appender>>& appender : appenders)
     {
         appender.second->setRealmId(id);
@@ -332,23 +533,22 @@ void Log::SetRealmId(uint32 id)
 
 void Log::Close()
 {
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
+    ++_loggersGeneration;
     loggers.clear();
     appenders.clear();
 }
 
-bool Log::ShouldLog(std::string const& type, LogLevel level) const
+bool Log::ShouldLog(std::string_view type, LogLevel level) const
 {
-    /// @todo: Use cache to store "Type.sub1.sub2": "Type" equivalence, should
-    // Speed up in cases where requesting "Type.sub1.sub2" but only configured
-    // Logger "Type"
-
     // Don't even look for a logger if the LogLevel is higher than the highest log levels across all loggers
     if (level > highestLogLevel)
     {
         return false;
     }
 
-    Logger const* logger = GetLoggerByType(type);
+    // "Type.sub1.sub2" resolves to the configured "Type" logger once per thread instead of on every call
+    Logger const* logger = GetCachedLoggerByType(type);
     if (!logger)
     {
         return false;
@@ -364,25 +564,34 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(Acore::Asio::IoContext* ioContext)
+void Log::Initialize(bool async)
 {
-    if (ioContext)
+    LoadFromConfig();
+
+    if (async)
     {
-        _ioContext = ioContext;
-        _strand = std::make_unique<Acore::Asio::Strand>(*ioContext);
+        _bufferSize = sConfigMgr->GetOption<uint32>("Log.Async.BufferSize", 4096);
+        _thread = std::thread(&Log::LogThread, this);
+        _async = true;
     }
-
-    LoadFromConfig();
 }
 
 void Log::SetSynchronous()
 {
-    _strand.reset();
-    _ioContext = nullptr;
+    if (!_thread.joinable())
+        return;
+
+    // The logging thread writes what is left in the buffers before it stops
+    _async = false;
+    _stopThread = true;
+    _wakeUp.notify_one();
+    _thread.join();
+    _stopThread = false;
 }
 
 void Log::LoadFromConfig()
 {
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
     Close();
 
     highestLogLevel = LOG_LEVEL_FATAL;
@@ -397,4 +606,7 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+
+    // Loggers resolved before the old ones were closed may have been cached again meanwhile
+    ++_loggersGeneration;
 }
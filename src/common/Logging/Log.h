@@ -22,6 +22,10 @@
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -29,15 +33,15 @@
 class Appender;
 class Logger;
 struct LogMessage;
-
-namespace Acore::Asio
-{
-    class IoContext;
-    class Strand;
-}
+struct LogThreadBuffer;
 
 #define LOGGER_ROOT "root"
 
+// Messages above this level are left out at compile time, see the LOG_MAX_LEVEL CMake option
+#ifndef ACORE_LOG_MAX_LEVEL
+#define ACORE_LOG_MAX_LEVEL LOG_LEVEL_TRACE
+#endif
+
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
 
 template <class AppenderImpl>
@@ -61,17 +65,18 @@ private:
 public:
     static Log* instance();
 
-    void Initialize(Acore::Asio::IoContext* ioContext = nullptr);
+    // With async every thread formats its messages into a buffer of its own, a logging thread writes them
+    void Initialize(bool async = false);
     void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
     void LoadFromConfig();
     void Close();
-    [[nodiscard]] bool ShouldLog(std::string const& type, LogLevel level) const;
+    [[nodiscard]] bool ShouldLog(std::string_view type, LogLevel level) const;
     bool SetLogLevel(std::string const& name, int32 level, bool isLogger = true);
 
     template<typename... Args>
-    inline void outMessage(std::string const& filter, LogLevel const level, Acore::FormatString<Args...> fmt, Args&&... args)
+    inline void outMessage(std::string_view filter, LogLevel const level, Acore::FormatString<Args...> fmt, Args&&... args)
     {
-        _outMessage(filter, level, Acore::StringFormat(fmt, std::forward<Args>(args)...));
+        _outMessage(filter, level, fmt.get(), fmt::make_format_args(args...), {});
     }
 
     template<typename... Args>
@@ -82,9 +87,12 @@ public:
             return;
         }
 
-        _outCommand(Acore::StringFormat(fmt, std::forward<Args>(args)...), std::to_string(account));
+        _outMessage("commands.gm", LOG_LEVEL_INFO, fmt.get(), fmt::make_format_args(args...), std::to_string(account));
     }
 
+    //! Messages dropped because the buffer of the logging thread was full, since the start
+    [[nodiscard]] uint64 GetDroppedMessages() const { return _droppedMessages.load(std::memory_order_relaxed); }
+
     void SetRealmId(uint32 id);
 
     template<class AppenderImpl>
@@ -98,9 +106,9 @@ public:
 
 private:
     static std::string GetTimestampStr();
-    void write(std::unique_ptr<LogMessage>&& msg) const;
 
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
+    [[nodiscard]] Logger const* GetCachedLoggerByType(std::string_view type) const;
     Appender* GetAppenderByName(std::string_view name);
     uint8 NextAppenderId();
     void CreateAppenderFromConfig(std::string const& name);
@@ -108,8 +116,12 @@ private:
     void ReadAppendersFromConfig();
     void ReadLoggersFromConfig();
     void RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn);
-    void _outMessage(std::string const& filter, LogLevel level, std::string_view message);
-    void _outCommand(std::string_view message, std::string_view param1);
+    void _outMessage(std::string_view filter, LogLevel level, fmt::string_view format, fmt::format_args args, std::string_view param1);
+    void _enqueueMessage(std::string_view filter, LogLevel level, fmt::string_view format, fmt::format_args args, std::string_view param1);
+
+    LogThreadBuffer& GetThreadBuffer();
+    void LogThread();
+    void WriteBuffered();
 
     std::unordered_map<uint8, AppenderCreatorFn> appenderFactory;
     std::unordered_map<uint8, std::unique_ptr<Appender>> appenders;
@@ -120,8 +132,22 @@ private:
     std::string m_logsDir;
     std::string m_logsTimestamp;
 
-    Acore::Asio::IoContext* _ioContext;
-    std::unique_ptr<Acore::Asio::Strand> _strand;
+    // Bumped whenever the loggers are recreated, drops the loggers cached per thread
+    std::atomic<uint32> _loggersGeneration{1};
+
+    // Asynchronous logging, see Initialize
+    std::atomic<bool> _async{false};
+    std::size_t _bufferSize = 0;
+    std::vector<std::shared_ptr<LogThreadBuffer>> _buffers;
+    std::mutex _buffersLock;
+    std::thread _thread;
+    std::atomic<bool> _stopThread{false};
+    std::mutex _wakeUpLock;
+    std::condition_variable _wakeUp;
+    std::atomic<uint64> _droppedMessages{0};
+
+    // Held by the logging thread while writing, changing loggers and appenders waits for it
+    std::recursive_mutex _writeLock;
 };
 
 #define sLog Log::instance()
@@ -130,7 +156,7 @@ private:
     { \
         try \
         { \
-            sLog->outMessage(filterType__, level__, fmt::format(__VA_ARGS__)); \
+            sLog->outMessage(filterType__, level__, __VA_ARGS__); \
         } \
         catch (std::exception const& e) \
         { \
@@ -145,7 +171,7 @@ private:
 #define LOG_MESSAGE_BODY(filterType__, level__, ...)                        \
         do                                                              \
         {                                                               \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            if (level__ <= ACORE_LOG_MAX_LEVEL && sLog->ShouldLog(filterType__, level__)) \
                 LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
         } while (0)
 #endif
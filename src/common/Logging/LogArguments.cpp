@@ -0,0 +1,271 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogArguments.h"
+#include "StringFormat.h"
+#include <cstring>
+#include <fmt/args.h>
+#include <type_traits>
+
+namespace
+{
+    enum ArgumentType : uint8
+    {
+        ARGUMENT_SIGNED     = 0,    // zigzag varint
+        ARGUMENT_UNSIGNED   = 1,    // varint
+        ARGUMENT_BOOL       = 2,    // uint8
+        ARGUMENT_CHAR       = 3,    // uint8
+        ARGUMENT_FLOAT      = 4,    // 4 bytes
+        ARGUMENT_DOUBLE     = 5,    // 8 bytes
+        ARGUMENT_STRING     = 6,    // varint length, bytes
+        ARGUMENT_POINTER    = 7     // varint
+    };
+
+    template<typename T>
+    void AppendRaw(std::string& out, T value)
+    {
+        out.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadRaw(std::string_view& in, T& value)
+    {
+        if (in.size() < sizeof(T))
+            return false;
+
+        memcpy(&value, in.data(), sizeof(T));
+        in.remove_prefix(sizeof(T));
+        return true;
+    }
+
+    void AppendString(std::string& out, std::string_view value)
+    {
+        out.push_back(ARGUMENT_STRING);
+        Acore::LogArguments::AppendVarint(out, value.size());
+        out.append(value);
+    }
+
+    struct ArgumentEncoder
+    {
+        std::string& Out;
+        fmt::basic_format_arg<fmt::format_context> const& Arg;
+
+        void operator()(fmt::monostate) const
+        {
+            // 128 bit integers on platforms without them
+            AppendString(Out, "");
+        }
+
+        void operator()(bool value) const
+        {
+            Out.push_back(ARGUMENT_BOOL);
+            Out.push_back(char(value));
+        }
+
+        void operator()(char value) const
+        {
+            Out.push_back(ARGUMENT_CHAR);
+            Out.push_back(value);
+        }
+
+        void operator()(float value) const
+        {
+            Out.push_back(ARGUMENT_FLOAT);
+            AppendRaw(Out, value);
+        }
+
+        void operator()(double value) const
+        {
+            Out.push_back(ARGUMENT_DOUBLE);
+            AppendRaw(Out, value);
+        }
+
+        void operator()(long double value) const
+        {
+            (*this)(double(value));
+        }
+
+        void operator()(char const* value) const
+        {
+            AppendString(Out, value ? std::string_view(value) : std::string_view());
+        }
+
+        void operator()(fmt::string_view value) const
+        {
+            AppendString(Out, std::string_view(value.data(), value.size()));
+        }
+
+        void operator()(void const* value) const
+        {
+            Out.push_back(ARGUMENT_POINTER);
+            Acore::LogArguments::AppendVarint(Out, reinterpret_cast<uintptr_t>(value));
+        }
+
+        void operator()(fmt::basic_format_arg<fmt::format_context>::handle) const
+        {
+            // Only the caller can format user-defined types, their default format is kept
+            AppendString(Out, fmt::vformat("{}", fmt::format_args(&Arg, 1)));
+        }
+
+        template<typename T>
+        void operator()(T value) const
+        {
+            if constexpr (sizeof(T) > sizeof(uint64))
+                AppendString(Out, fmt::format("{}", value));
+            else if constexpr (std::is_signed_v<T>)
+            {
+                int64 const signedValue = value;
+                Out.push_back(ARGUMENT_SIGNED);
+                Acore::LogArguments::AppendVarint(Out, (uint64(signedValue) << 1) ^ uint64(signedValue >> 63));
+            }
+            else
+            {
+                Out.push_back(ARGUMENT_UNSIGNED);
+                Acore::LogArguments::AppendVarint(Out, value);
+            }
+        }
+    };
+
+    bool Decode(std::string_view encoded, fmt::dynamic_format_arg_store<fmt::format_context>& store)
+    {
+        while (!encoded.empty())
+        {
+            uint8 const type = encoded.front();
+            encoded.remove_prefix(1);
+
+            uint64 value = 0;
+            switch (type)
+            {
+                case ARGUMENT_SIGNED:
+                    if (!Acore::LogArguments::ReadVarint(encoded, value))
+                        return false;
+                    store.push_back(int64(value >> 1) ^ -int64(value & 1));
+                    break;
+                case ARGUMENT_UNSIGNED:
+                    if (!Acore::LogArguments::ReadVarint(encoded, value))
+                        return false;
+                    store.push_back(value);
+                    break;
+                case ARGUMENT_BOOL:
+                case ARGUMENT_CHAR:
+                {
+                    char c;
+                    if (!ReadRaw(encoded, c))
+                        return false;
+                    if (type == ARGUMENT_BOOL)
+                        store.push_back(c != 0);
+                    else
+                        store.push_back(c);
+                    break;
+                }
+                case ARGUMENT_FLOAT:
+                {
+                    float f;
+                    if (!ReadRaw(encoded, f))
+                        return false;
+                    store.push_back(f);
+                    break;
+                }
+                case ARGUMENT_DOUBLE:
+                {
+                    double d;
+                    if (!ReadRaw(encoded, d))
+                        return false;
+                    store.push_back(d);
+                    break;
+                }
+                case ARGUMENT_STRING:
+                    if (!Acore::LogArguments::ReadVarint(encoded, value) || encoded.size() < value)
+                        return false;
+                    store.push_back(std::string(encoded.substr(0, value)));
+                    encoded.remove_prefix(value);
+                    break;
+                case ARGUMENT_POINTER:
+                    if (!Acore::LogArguments::ReadVarint(encoded, value))
+                        return false;
+                    store.push_back(reinterpret_cast<void const*>(uintptr_t(value)));
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+void Acore::LogArguments::Encode(std::string& out, fmt::format_args args)
+{
+    for (int i = 0; ; ++i)
+    {
+        fmt::basic_format_arg<fmt::format_context> const arg = args.get(i);
+        if (!arg)
+            break;
+
+        try
+        {
+            fmt::visit_format_arg(ArgumentEncoder{ out, arg }, arg);
+        }
+        catch (std::exception const& e)
+        {
+            AppendString(out, Acore::StringFormat("<{}>", e.what()));
+        }
+    }
+}
+
+std::string Acore::LogArguments::Format(std::string_view format, std::string_view encoded)
+{
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    if (!Decode(encoded, store))
+        return Acore::StringFormat("Damaged log arguments. Fmt string: '{}'", format);
+
+    try
+    {
+        return fmt::vformat(format, store);
+    }
+    catch (std::exception const& e)
+    {
+        return Acore::StringFormat("Wrong format occurred ({}). Fmt string: '{}'", e.what(), format);
+    }
+}
+
+void Acore::LogArguments::AppendVarint(std::string& out, uint64 value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(char(value | 0x80));
+        value >>= 7;
+    }
+
+    out.push_back(char(value));
+}
+
+bool Acore::LogArguments::ReadVarint(std::string_view& in, uint64& value)
+{
+    value = 0;
+    for (uint32 shift = 0; shift < 64 && !in.empty(); shift += 7)
+    {
+        uint8 const byte = in.front();
+        in.remove_prefix(1);
+
+        value |= uint64(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOG_ARGUMENTS_H
+#define _LOG_ARGUMENTS_H
+
+#include "Define.h"
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+
+/**
+ * Compact binary form of the arguments of a log message.
+ *
+ * Integers are stored as varints and strings length-prefixed, so encoding costs far less than
+ * formatting the message and the result does not refer to the caller's arguments anymore.
+ * Arguments of user-defined types are formatted right away and stored as strings.
+ */
+namespace Acore::LogArguments
+{
+    AC_COMMON_API void Encode(std::string& out, fmt::format_args args);
+
+    //! Formats the message, errors in the format string or the arguments are returned as the text
+    AC_COMMON_API std::string Format(std::string_view format, std::string_view encoded);
+
+    AC_COMMON_API void AppendVarint(std::string& out, uint64 value);
+    AC_COMMON_API bool ReadVarint(std::string_view& in, uint64& value);
+}
+
+#endif
@@ -36,11 +36,15 @@ struct LogMessage
 
     LogLevel const level;
     std::string const type;
-    std::string const text;
+    std::string text;
     std::string prefix;
     std::string param1;
     Seconds mtime;
 
+    // Kept for appenders writing the message unformatted, see LogArguments
+    std::string format;
+    std::string arguments;
+
     ///@ Returns size of the log message content in bytes
     uint32 Size() const
     {
@@ -18,6 +18,7 @@
 #include "Logger.h"
 #include "Appender.h"
 #include "LogMessage.h"
+#include <algorithm>
 
 Logger::Logger(std::string const& _name, LogLevel _level): name(_name), level(_level) { }
 
@@ -46,9 +47,25 @@ void Logger::setLogLevel(LogLevel _level)
     level = _level;
 }
 
+bool Logger::HasTextAppenders() const
+{
+    return std::any_of(appenders.begin(), appenders.end(), [](std::pair<uint8 const, Appender*> const& appender)
+    {
+        return appender.second && appender.second->WritesText();
+    });
+}
+
+bool Logger::HasBinaryAppenders() const
+{
+    return std::any_of(appenders.begin(), appenders.end(), [](std::pair<uint8 const, Appender*> const& appender)
+    {
+        return appender.second && !appender.second->WritesText();
+    });
+}
+
 void Logger::write(LogMessage* message) const
 {
-    if (!level || level < message->level || message->text.empty())
+    if (!level || level < message->level || (message->text.empty() && message->format.empty()))
     {
         //fprintf(stderr, "Logger::write: Logger %s, Level %u. Msg %s Level %u WRONG LEVEL MASK OR EMPTY MSG\n", getName().c_str(), getLogLevel(), message.text.c_str(), message.level);
         return;
@@ -39,6 +39,9 @@ public:
     void setLogLevel(LogLevel level);
     void write(LogMessage* message) const;
 
+    bool HasTextAppenders() const;
+    bool HasBinaryAppenders() const;
+
 private:
     std::string name;
     LogLevel level;
@@ -90,12 +90,13 @@ AC_API_EXPORT EnumText EnumUtils<AppenderType>::ToString(AppenderType value)
         case APPENDER_CONSOLE: return { "APPENDER_CONSOLE", "APPENDER_CONSOLE", "" };
         case APPENDER_FILE: return { "APPENDER_FILE", "APPENDER_FILE", "" };
         case APPENDER_DB: return { "APPENDER_DB", "APPENDER_DB", "" };
+        case APPENDER_BINARY: return { "APPENDER_BINARY", "APPENDER_BINARY", "" };
         default: throw std::out_of_range("value");
     }
 }
 
 template <>
-AC_API_EXPORT std::size_t EnumUtils<AppenderType>::Count() { return 4; }
+AC_API_EXPORT std::size_t EnumUtils<AppenderType>::Count() { return 5; }
 
 template <>
 AC_API_EXPORT AppenderType EnumUtils<AppenderType>::FromIndex(std::size_t index)
@@ -106,6 +107,7 @@ AC_API_EXPORT AppenderType EnumUtils<AppenderType>::FromIndex(std::size_t index)
         case 1: return APPENDER_CONSOLE;
         case 2: return APPENDER_FILE;
         case 3: return APPENDER_DB;
+        case 4: return APPENDER_BINARY;
         default: throw std::out_of_range("index");
     }
 }
@@ -119,6 +121,7 @@ AC_API_EXPORT std::size_t EnumUtils<AppenderType>::ToIndex(AppenderType value)
         case APPENDER_CONSOLE: return 1;
         case APPENDER_FILE: return 2;
         case APPENDER_DB: return 3;
+        case APPENDER_BINARY: return 4;
         default: throw std::out_of_range("value");
     }
 }
@@ -18,11 +18,68 @@
 #include "Metric.h"
 #include "Config.h"
 #include "Log.h"
+#include "MetricExporter.h"
 #include "SteadyTimer.h"
 #include "Strand.h"
+#include "StringFormat.h"
 #include "Tokenize.h"
+#include <array>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <cctype>
+
+namespace
+{
+    // Prometheus names only allow [a-zA-Z0-9_:] and must not start with a digit
+    std::string FormatPrometheusName(std::string const& name)
+    {
+        std::string result = name;
+        for (char& c : result)
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':')
+                c = '_';
+
+        if (result.empty() || std::isdigit(static_cast<unsigned char>(result[0])))
+            result.insert(result.begin(), '_');
+
+        return result;
+    }
+
+    std::string FormatPrometheusLabels(std::string const& realmName, std::vector<MetricTag> const& tags, std::string_view quantile = {})
+    {
+        std::string labels;
+        auto append = [&labels](std::string_view name, std::string_view value)
+        {
+            labels += labels.empty() ? '{' : ',';
+            labels += name;
+            labels += "=\"";
+            for (char c : value)
+            {
+                switch (c)
+                {
+                    case '\\': labels += "\\\\"; break;
+                    case '"': labels += "\\\""; break;
+                    case '\n': labels += "\\n"; break;
+                    default: labels += c; break;
+                }
+            }
+            labels += '"';
+        };
+
+        if (!realmName.empty())
+            append("realm", realmName);
+
+        for (MetricTag const& tag : tags)
+            append(FormatPrometheusName(tag.first), tag.second);
+
+        if (!quantile.empty())
+            append("quantile", quantile);
+
+        if (!labels.empty())
+            labels += '}';
+
+        return labels;
+    }
+}
 
 Metric::Metric()
 {
@@ -45,6 +102,8 @@ void Metric::Initialize(std::string const& realmName, Acore::Asio::IoContext& io
     _batchTimer = std::make_unique<boost::asio::steady_timer>(ioContext);
     _overallStatusTimer = std::make_unique<boost::asio::steady_timer>(ioContext);
     _overallStatusLogger = overallStatusLogger;
+    _exporterRealmName = realmName;
+    _exporter = std::make_unique<MetricExporter>(ioContext, [this]() { return GetPrometheusText(); });
     LoadFromConfigs();
 }
 
@@ -69,6 +128,7 @@ bool Metric::Connect()
 
 void Metric::LoadFromConfigs()
 {
+    bool const wasEnabled = IsEnabled();
     bool previousValue = _enabled;
     _enabled = sConfigMgr->GetOption<bool>("Metric.Enable", false);
     _updateInterval = sConfigMgr->GetOption<int32>("Metric.Interval", 1);
@@ -95,6 +155,12 @@ void Metric::LoadFromConfigs()
         _thresholds[thresholdName] = thresholdValue;
     }
 
+    LoadExporterConfigs();
+
+    // The overall status is gathered for both InfluxDB and the exporter
+    if (IsEnabled() && !wasEnabled)
+        ScheduleOverallStatusLog();
+
     // Schedule a send at this point only if the config changed from Disabled to Enabled.
     // Cancel any scheduled operation if the config changed from Enabled to Disabled.
     if (_enabled && !previousValue)
@@ -143,10 +209,49 @@ void Metric::LoadFromConfigs()
 
         Connect();
         ScheduleSend();
-        ScheduleOverallStatusLog();
     }
 }
 
+void Metric::LoadExporterConfigs()
+{
+    bool const previousValue = _exporting;
+    bool const exporting = sConfigMgr->GetOption<bool>("Metric.Prometheus.Enable", false);
+
+    Seconds quantileWindow = Seconds(sConfigMgr->GetOption<int32>("Metric.Prometheus.QuantileWindow", 60));
+    if (quantileWindow < 1s)
+    {
+        LOG_ERROR("metric", "'Metric.Prometheus.QuantileWindow' config set to {}, overriding to 1.", quantileWindow.count());
+        quantileWindow = 1s;
+    }
+
+    Seconds seriesExpiry = Seconds(sConfigMgr->GetOption<int32>("Metric.Prometheus.SeriesExpiry", 300));
+    if (seriesExpiry < 0s)
+    {
+        LOG_ERROR("metric", "'Metric.Prometheus.SeriesExpiry' config set to {}, overriding to 0.", seriesExpiry.count());
+        seriesExpiry = 0s;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(_renderLock);
+        _quantileWindow = quantileWindow;
+        _seriesExpiry = seriesExpiry;
+    }
+
+    if (!_exporter || exporting == previousValue)
+        return;
+
+    if (!exporting)
+    {
+        _exporting = false;
+        _exporter->Close();
+        return;
+    }
+
+    std::string const bindIp = sConfigMgr->GetOption<std::string>("Metric.Prometheus.BindIP", "127.0.0.1");
+    uint16 const port = sConfigMgr->GetOption<uint16>("Metric.Prometheus.Port", 9101);
+    _exporting = _exporter->Start(bindIp, port);
+}
+
 void Metric::Update()
 {
     if (_overallStatusTimerTriggered)
@@ -172,6 +277,9 @@ void Metric::LogEvent(std::string const& category, std::string const& title, std
 {
     using namespace std::chrono;
 
+    if (!_enabled)
+        return;
+
     MetricData* data = new MetricData;
     data->Category = category;
     data->Timestamp = system_clock::now();
@@ -308,11 +416,191 @@ void Metric::Unload()
 
     _batchTimer->cancel();
     _overallStatusTimer->cancel();
+
+    if (_exporting)
+    {
+        _exporting = false;
+        _exporter->Close();
+    }
+}
+
+template<class Series, class Updater>
+void Metric::UpdateExportedSeries(std::map<std::string, std::unique_ptr<Series>>& series, std::string const& name, std::vector<MetricTag> const& tags, Updater update)
+{
+    // '\0' sorts the series of one name next to each other, ahead of longer names
+    std::string key = name;
+    for (MetricTag const& tag : tags)
+    {
+        key += '\0';
+        key += tag.first;
+        key += '=';
+        key += tag.second;
+    }
+
+    auto apply = [&update](Series& entry)
+    {
+        update(entry);
+
+        // read first, most updates find the flag set already and leave its cache line shared
+        if (!entry.Updated.load(std::memory_order_relaxed))
+            entry.Updated.store(true, std::memory_order_relaxed);
+    };
+
+    {
+        std::shared_lock<std::shared_mutex> guard(_exportedLock);
+        auto itr = series.find(key);
+        if (itr != series.end())
+        {
+            apply(*itr->second);
+            return;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> guard(_exportedLock);
+    std::unique_ptr<Series>& entry = series[key];
+    if (!entry)
+    {
+        entry = std::make_unique<Series>();
+        entry->Name = name;
+        entry->Tags = tags;
+    }
+
+    apply(*entry);
+}
+
+template<class Series>
+void Metric::ExpireExportedSeries(std::map<std::string, std::unique_ptr<Series>>& series, uint32 maxIdleWindows)
+{
+    std::erase_if(series, [maxIdleWindows](auto const& entry)
+    {
+        if (entry.second->Updated.exchange(false, std::memory_order_relaxed))
+        {
+            entry.second->IdleWindows = 0;
+            return false;
+        }
+
+        return ++entry.second->IdleWindows >= maxIdleWindows;
+    });
+}
+
+void Metric::AddCounter(std::string const& category, uint64 value, std::vector<MetricTag> const& tags)
+{
+    UpdateExportedSeries(_counters, category, tags, [value](ExportedCounter& counter)
+    {
+        counter.Value.fetch_add(value, std::memory_order_relaxed);
+    });
+}
+
+void Metric::SetGauge(std::string const& category, double value, std::vector<MetricTag> const& tags)
+{
+    UpdateExportedSeries(_gauges, category, tags, [value](ExportedGauge& gauge)
+    {
+        gauge.Value.store(value, std::memory_order_relaxed);
+    });
+}
+
+void Metric::RecordHistogram(std::string const& category, uint64 value, std::vector<MetricTag> const& tags, double divisor)
+{
+    UpdateExportedSeries(_histograms, category, tags, [value, divisor](ExportedHistogram& histogram)
+    {
+        histogram.Divisor.store(divisor, std::memory_order_relaxed);
+        histogram.Histogram.Record(value);
+    });
+}
+
+std::string Metric::GetPrometheusText()
+{
+    static constexpr std::array<std::pair<double, std::string_view>, 5> Quantiles =
+    { {
+        { 0.5, "0.5" }, { 0.9, "0.9" }, { 0.95, "0.95" }, { 0.99, "0.99" }, { 0.999, "0.999" }
+    } };
+
+    std::lock_guard<std::mutex> renderGuard(_renderLock);
+
+    // Quantiles cover the values recorded since the start of the previous window,
+    // so they follow recent changes instead of averaging the whole uptime
+    TimePoint const now = std::chrono::steady_clock::now();
+    bool const newWindow = now - _quantileWindowStart >= _quantileWindow;
+    if (newWindow)
+        _quantileWindowStart = now;
+
+    // Series of e.g. unloaded instances are not updated anymore, stop serving their last values
+    if (newWindow && _seriesExpiry > 0s)
+    {
+        uint32 const maxIdleWindows = uint32((_seriesExpiry.count() + _quantileWindow.count() - 1) / _quantileWindow.count());
+
+        std::unique_lock<std::shared_mutex> guard(_exportedLock);
+        ExpireExportedSeries(_counters, maxIdleWindows);
+        ExpireExportedSeries(_gauges, maxIdleWindows);
+        ExpireExportedSeries(_histograms, maxIdleWindows);
+    }
+
+    std::shared_lock<std::shared_mutex> guard(_exportedLock);
+
+    std::string text;
+    std::string_view lastName;
+    auto writeType = [&](std::string const& name, std::string_view type)
+    {
+        if (name == lastName)
+            return;
+
+        lastName = name;
+        text += Acore::StringFormat("# TYPE {} {}\n", FormatPrometheusName(name), type);
+    };
+
+    for (auto const& [key, counter] : _counters)
+    {
+        writeType(counter->Name, "counter");
+        text += Acore::StringFormat("{}{} {}\n", FormatPrometheusName(counter->Name), FormatPrometheusLabels(_exporterRealmName, counter->Tags),
+            counter->Value.load(std::memory_order_relaxed));
+    }
+
+    for (auto const& [key, gauge] : _gauges)
+    {
+        writeType(gauge->Name, "gauge");
+        text += Acore::StringFormat("{}{} {}\n", FormatPrometheusName(gauge->Name), FormatPrometheusLabels(_exporterRealmName, gauge->Tags),
+            gauge->Value.load(std::memory_order_relaxed));
+    }
+
+    for (auto const& [key, histogram] : _histograms)
+    {
+        MetricHistogram::Counts counts = histogram->Histogram.GetCounts();
+        if (histogram->WindowStart.empty())
+            histogram->WindowStart.resize(counts.size());
+
+        if (histogram->PreviousWindowStart.empty())
+            histogram->PreviousWindowStart.resize(counts.size());
+
+        if (newWindow)
+        {
+            histogram->PreviousWindowStart = std::move(histogram->WindowStart);
+            histogram->WindowStart = counts;
+        }
+
+        MetricHistogram::Counts window(counts.size());
+        for (std::size_t i = 0; i < counts.size(); ++i)
+            window[i] = counts[i] - histogram->PreviousWindowStart[i];
+
+        std::string const name = FormatPrometheusName(histogram->Name);
+        double const divisor = histogram->Divisor.load(std::memory_order_relaxed);
+        writeType(histogram->Name, "summary");
+        for (auto const& [quantile, label] : Quantiles)
+        {
+            double const value = MetricHistogram::GetValueAtQuantile(window, quantile) / divisor;
+            text += Acore::StringFormat("{}{} {}\n", name, FormatPrometheusLabels(_exporterRealmName, histogram->Tags, label), value);
+        }
+
+        std::string const labels = FormatPrometheusLabels(_exporterRealmName, histogram->Tags);
+        text += Acore::StringFormat("{}_sum{} {}\n", name, labels, histogram->Histogram.GetSum() / divisor);
+        text += Acore::StringFormat("{}_count{} {}\n", name, labels, histogram->Histogram.GetCount());
+    }
+
+    return text;
 }
 
 void Metric::ScheduleOverallStatusLog()
 {
-    if (_enabled)
+    if (IsEnabled())
     {
         _overallStatusTimer->expires_at(Acore::Asio::SteadyTimer::GetExpirationTime(_overallStatusTimerInterval));
         _overallStatusTimer->async_wait([this](const boost::system::error_code&)
@@ -21,10 +21,16 @@
 #include "Define.h"
 #include "Duration.h"
 #include "MPSCQueue.h"
+#include "MetricHistogram.h"
+#include <atomic>
 #include <boost/asio/steady_timer.hpp>
 #include <functional>
+#include <map>
 #include <memory> // NOTE: this import is NEEDED (even though some IDEs report it as unused)
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +47,8 @@ enum MetricDataType
 
 typedef std::pair<std::string, std::string> MetricTag;
 
+class MetricExporter;
+
 struct MetricData
 {
     std::string Category;
@@ -79,6 +87,45 @@ private:
     std::string _realmName;
     std::unordered_map<std::string, int64> _thresholds;
 
+    // Current values served by the exporter, keyed by name and tags
+    struct ExportedSeries
+    {
+        std::string Name;
+        std::vector<MetricTag> Tags;
+        std::atomic<bool> Updated{true};                 // since the last quantile window started
+        uint32 IdleWindows = 0;
+    };
+
+    struct ExportedCounter : ExportedSeries
+    {
+        std::atomic<uint64> Value{0};
+    };
+
+    struct ExportedGauge : ExportedSeries
+    {
+        std::atomic<double> Value{0.0};
+    };
+
+    struct ExportedHistogram : ExportedSeries
+    {
+        std::atomic<double> Divisor{1.0};
+        MetricHistogram Histogram;
+        MetricHistogram::Counts WindowStart;
+        MetricHistogram::Counts PreviousWindowStart;
+    };
+
+    bool _exporting = false;
+    std::string _exporterRealmName;
+    Seconds _quantileWindow = 60s;
+    Seconds _seriesExpiry = 300s;
+    TimePoint _quantileWindowStart;
+    std::unique_ptr<MetricExporter> _exporter;
+    std::shared_mutex _exportedLock;
+    std::mutex _renderLock;
+    std::map<std::string, std::unique_ptr<ExportedCounter>> _counters;
+    std::map<std::string, std::unique_ptr<ExportedGauge>> _gauges;
+    std::map<std::string, std::unique_ptr<ExportedHistogram>> _histograms;
+
     bool Connect();
     void SendBatch();
     void ScheduleSend();
@@ -97,6 +144,25 @@ private:
 
     static std::string FormatInfluxDBTagValue(std::string const& value);
 
+    void LoadExporterConfigs();
+
+    // Timers become histograms, numbers become gauges
+    template<class T>
+    void ExportValue(std::string const& category, T value, std::vector<MetricTag> const& tags)
+    {
+        if constexpr (requires { std::chrono::duration_cast<Microseconds>(value); })
+            RecordHistogram(category, uint64(std::chrono::duration_cast<Microseconds>(value).count()), tags, 1000.0);
+        else if constexpr (std::is_arithmetic_v<T>)
+            SetGauge(category, double(value), tags);
+    }
+
+    // Series are removed while not updated, update is called with the series locked
+    template<class Series, class Updater>
+    void UpdateExportedSeries(std::map<std::string, std::unique_ptr<Series>>& series, std::string const& name, std::vector<MetricTag> const& tags, Updater update);
+
+    template<class Series>
+    static void ExpireExportedSeries(std::map<std::string, std::unique_ptr<Series>>& series, uint32 maxIdleWindows);
+
     /// @todo: should format TagKey and FieldKey too in the same way as TagValue
 
 public:
@@ -112,9 +178,22 @@ public:
 
     template<class T>
     void LogValue(std::string const& category, T value, std::vector<MetricTag> tags)
+    {
+        if (_exporting)
+            ExportValue(category, value, tags);
+
+        SendValue(category, value, std::move(tags));
+    }
+
+    // Only sent to InfluxDB, for values logged per object that would overwrite each other in one exported gauge
+    template<class T>
+    void SendValue(std::string const& category, T value, std::vector<MetricTag> tags)
     {
         using namespace std::chrono;
 
+        if (!_enabled)
+            return;
+
         MetricData* data = new MetricData;
         data->Category = category;
         data->Timestamp = system_clock::now();
@@ -127,8 +206,21 @@ public:
 
     void LogEvent(std::string const& category, std::string const& title, std::string const& description);
 
+    // Only kept for the exporter, InfluxDB receives what is logged through LogValue
+    void AddCounter(std::string const& category, uint64 value, std::vector<MetricTag> const& tags);
+    void SetGauge(std::string const& category, double value, std::vector<MetricTag> const& tags);
+
+    // Divisor converts the recorded integers to the unit served, e.g. 1000 for microseconds served as milliseconds
+    void RecordHistogram(std::string const& category, uint64 value, std::vector<MetricTag> const& tags, double divisor = 1.0);
+
+    // Counters, gauges and histogram quantiles in the Prometheus text format
+    std::string GetPrometheusText();
+
     void Unload();
-    bool IsEnabled() const { return _enabled; }
+
+    // Either sending to InfluxDB or serving the exporter
+    bool IsEnabled() const { return _enabled || _exporting; }
+    bool IsExporting() const { return _exporting; }
 };
 
 #define sMetric Metric::instance()
@@ -173,6 +265,9 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
 #define METRIC_DETAILED_EVENT(category, title, description) ((void)0)
 #define METRIC_DETAILED_TIMER(category, ...) ((void)0)
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) ((void)0)
+#define METRIC_COUNTER(category, value, ...) ((void)0)
+#define METRIC_HISTOGRAM(category, value, ...) ((void)0)
+#define METRIC_INFLUXDB_VALUE(category, value, ...) ((void)0)
 #else
 #if AC_PLATFORM != AC_PLATFORM_WINDOWS
 #define METRIC_EVENT(category, title, description)                  \
@@ -185,6 +280,21 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
             if (sMetric->IsEnabled())                                  \
                 sMetric->LogValue(category, value, { __VA_ARGS__ });   \
         } while (0)
+#define METRIC_COUNTER(category, value, ...)                        \
+        do {                                                           \
+            if (sMetric->IsExporting())                                \
+                sMetric->AddCounter(category, value, { __VA_ARGS__ }); \
+        } while (0)
+#define METRIC_HISTOGRAM(category, value, ...)                      \
+        do {                                                           \
+            if (sMetric->IsExporting())                                \
+                sMetric->RecordHistogram(category, value, { __VA_ARGS__ }); \
+        } while (0)
+#define METRIC_INFLUXDB_VALUE(category, value, ...)                 \
+        do {                                                           \
+            if (sMetric->IsEnabled())                                  \
+                sMetric->SendValue(category, value, { __VA_ARGS__ });  \
+        } while (0)
 #else
 #define METRIC_EVENT(category, title, description)                  \
         __pragma(warning(push))                                        \
@@ -202,6 +312,30 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
                 sMetric->LogValue(category, value, { __VA_ARGS__ });   \
         } while (0)                                                    \
         __pragma(warning(pop))
+#define METRIC_COUNTER(category, value, ...)                        \
+        __pragma(warning(push))                                        \
+        __pragma(warning(disable:4127))                                \
+        do {                                                           \
+            if (sMetric->IsExporting())                                \
+                sMetric->AddCounter(category, value, { __VA_ARGS__ }); \
+        } while (0)                                                    \
+        __pragma(warning(pop))
+#define METRIC_HISTOGRAM(category, value, ...)                      \
+        __pragma(warning(push))                                        \
+        __pragma(warning(disable:4127))                                \
+        do {                                                           \
+            if (sMetric->IsExporting())                                \
+                sMetric->RecordHistogram(category, value, { __VA_ARGS__ }); \
+        } while (0)                                                    \
+        __pragma(warning(pop))
+#define METRIC_INFLUXDB_VALUE(category, value, ...)                 \
+        __pragma(warning(push))                                        \
+        __pragma(warning(disable:4127))                                \
+        do {                                                           \
+            if (sMetric->IsEnabled())                                  \
+                sMetric->SendValue(category, value, { __VA_ARGS__ });  \
+        } while (0)                                                    \
+        __pragma(warning(pop))
 #endif
 #define METRIC_TIMER(category, ...)                                                                           \
         MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
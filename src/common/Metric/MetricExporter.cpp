@@ -0,0 +1,191 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricExporter.h"
+#include "Duration.h"
+#include "IoContext.h"
+#include "IpAddress.h"
+#include "Log.h"
+#include "StringFormat.h"
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/write.hpp>
+#include <memory>
+
+namespace
+{
+    constexpr std::size_t MaxRequestSize = 8 * 1024;
+    constexpr Seconds RequestTimeout = 5s;
+
+    class MetricExporterConnection : public std::enable_shared_from_this<MetricExporterConnection>
+    {
+    public:
+        MetricExporterConnection(boost::asio::ip::tcp::socket&& socket, std::function<std::string()> render) :
+            _socket(std::move(socket)), _timer(_socket.get_executor()), _request(MaxRequestSize), _render(std::move(render)) { }
+
+        void Start()
+        {
+            // Both handlers run on the strand of the socket
+            _timer.expires_after(RequestTimeout);
+            _timer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+            {
+                if (!error)
+                {
+                    boost::system::error_code ignored;
+                    self->_socket.close(ignored);
+                }
+            });
+
+            boost::asio::async_read_until(_socket, _request, "\r\n\r\n",
+                [self = shared_from_this()](boost::system::error_code const& error, std::size_t /*bytes*/)
+            {
+                self->HandleRequest(error);
+            });
+        }
+
+    private:
+        void HandleRequest(boost::system::error_code const& error)
+        {
+            _timer.cancel();
+            if (error)
+                return;
+
+            std::istream stream(&_request);
+            std::string requestLine;
+            std::getline(stream, requestLine);
+            if (!requestLine.empty() && requestLine.back() == '\r')
+                requestLine.pop_back();
+
+            _response = MetricExporter::BuildResponse(requestLine, _render);
+            boost::asio::async_write(_socket, boost::asio::buffer(_response),
+                [self = shared_from_this()](boost::system::error_code const& /*error*/, std::size_t /*bytes*/)
+            {
+                boost::system::error_code ignored;
+                self->_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+                self->_socket.close(ignored);
+            });
+        }
+
+        boost::asio::ip::tcp::socket _socket;
+        boost::asio::steady_timer _timer;
+        boost::asio::streambuf _request;
+        std::function<std::string()> _render;
+        std::string _response;
+    };
+}
+
+MetricExporter::MetricExporter(Acore::Asio::IoContext& ioContext, std::function<std::string()> render) :
+    _acceptor(ioContext), _render(std::move(render)), _closed(false)
+{
+}
+
+MetricExporter::~MetricExporter()
+{
+    Close();
+}
+
+bool MetricExporter::Start(std::string const& bindIp, uint16 port)
+{
+    boost::system::error_code error;
+    boost::asio::ip::address address = Acore::Net::make_address(bindIp, error);
+    if (error)
+    {
+        LOG_ERROR("metric", "Invalid metric exporter address {}: {}", bindIp, error.message());
+        return false;
+    }
+
+    boost::asio::ip::tcp::endpoint endpoint(address, port);
+    _acceptor.open(endpoint.protocol(), error);
+    if (!error)
+        _acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true), error);
+
+    if (!error)
+        _acceptor.bind(endpoint, error);
+
+    if (!error)
+        _acceptor.listen(boost::asio::socket_base::max_listen_connections, error);
+
+    if (error)
+    {
+        LOG_ERROR("metric", "Could not start the metric exporter on {}:{}: {}", bindIp, port, error.message());
+        _acceptor.close(error);
+        return false;
+    }
+
+    LOG_INFO("metric", "Serving metrics on http://{}:{}/metrics", bindIp, port);
+    _closed = false;
+    AsyncAccept();
+    return true;
+}
+
+void MetricExporter::Close()
+{
+    if (_closed.exchange(true))
+        return;
+
+    boost::system::error_code error;
+    _acceptor.close(error);
+}
+
+void MetricExporter::AsyncAccept()
+{
+    _acceptor.async_accept(boost::asio::make_strand(_acceptor.get_executor()),
+        [this](boost::system::error_code const& error, boost::asio::ip::tcp::socket socket)
+    {
+        if (error == boost::asio::error::operation_aborted || _closed)
+            return;
+
+        if (!error)
+            std::make_shared<MetricExporterConnection>(std::move(socket), _render)->Start();
+
+        AsyncAccept();
+    });
+}
+
+std::string MetricExporter::BuildResponse(std::string_view requestLine, std::function<std::string()> const& render)
+{
+    std::string_view status = "200 OK";
+    std::string_view contentType = "text/plain; version=0.0.4; charset=utf-8";
+    std::string body;
+
+    if (!requestLine.starts_with("GET "))
+    {
+        status = "405 Method Not Allowed";
+        contentType = "text/plain";
+        body = "Only GET is supported\n";
+    }
+    else
+    {
+        std::string_view path = requestLine.substr(4);
+        path = path.substr(0, path.find(' '));
+        path = path.substr(0, path.find('?'));
+
+        if (path == "/metrics")
+            body = render();
+        else
+        {
+            status = "404 Not Found";
+            contentType = "text/plain";
+            body = "Metrics are served at /metrics\n";
+        }
+    }
+
+    return Acore::StringFormat("HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+        status, contentType, body.size(), body);
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _METRIC_EXPORTER_H
+#define _METRIC_EXPORTER_H
+
+#include "Define.h"
+#include <atomic>
+#include <boost/asio/ip/tcp.hpp>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Acore::Asio
+{
+    class IoContext;
+}
+
+/**
+ * @brief Minimal HTTP server answering GET /metrics with the text returned by the render callback.
+ *
+ * Runs on the given IoContext, every connection serves a single request and is closed after
+ * the response or when the client does not send a request within a few seconds.
+ */
+class AC_COMMON_API MetricExporter
+{
+public:
+    MetricExporter(Acore::Asio::IoContext& ioContext, std::function<std::string()> render);
+    ~MetricExporter();
+
+    MetricExporter(MetricExporter const&) = delete;
+    MetricExporter& operator=(MetricExporter const&) = delete;
+
+    bool Start(std::string const& bindIp, uint16 port);
+    void Close();
+
+    //! Builds the whole HTTP response to a request line like "GET /metrics HTTP/1.1"
+    static std::string BuildResponse(std::string_view requestLine, std::function<std::string()> const& render);
+
+private:
+    void AsyncAccept();
+
+    boost::asio::ip::tcp::acceptor _acceptor;
+    std::function<std::string()> _render;
+    std::atomic<bool> _closed;
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricHistogram.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+void MetricHistogram::Record(uint64 value)
+{
+    value = std::min(value, MaxValue);
+
+    _buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+MetricHistogram::Counts MetricHistogram::GetCounts() const
+{
+    Counts counts(BucketCount);
+    for (std::size_t i = 0; i < BucketCount; ++i)
+        counts[i] = _buckets[i].load(std::memory_order_relaxed);
+
+    return counts;
+}
+
+uint64 MetricHistogram::GetValueAtQuantile(Counts const& counts, double quantile)
+{
+    uint64 total = 0;
+    for (uint64 count : counts)
+        total += count;
+
+    if (!total)
+        return 0;
+
+    // Rank of the wanted value, counting from 1
+    uint64 const rank = std::max<uint64>(1, uint64(std::ceil(std::clamp(quantile, 0.0, 1.0) * total)));
+
+    uint64 seen = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+            return GetBucketValue(i);
+    }
+
+    return GetBucketValue(counts.size() - 1);
+}
+
+std::size_t MetricHistogram::GetBucketIndex(uint64 value)
+{
+    if (value < SubBucketCount)
+        return std::size_t(value);
+
+    // Position of the highest set bit, the next SubBucketBits bits select the sub bucket
+    uint32 const exponent = std::bit_width(value) - 1;
+    uint32 const shift = exponent - SubBucketBits;
+    return std::size_t(shift + 1) * SubBucketCount + std::size_t((value >> shift) - SubBucketCount);
+}
+
+uint64 MetricHistogram::GetBucketValue(std::size_t index)
+{
+    if (index < SubBucketCount)
+        return index;
+
+    uint32 const shift = uint32(index / SubBucketCount) - 1;
+    uint64 const lower = uint64(index % SubBucketCount + SubBucketCount) << shift;
+    return lower + ((uint64(1) << shift) >> 1);
+}
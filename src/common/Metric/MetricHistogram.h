@@ -0,0 +1,71 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _METRIC_HISTOGRAM_H
+#define _METRIC_HISTOGRAM_H
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief Lock-free histogram with a bounded relative error, in the style of HdrHistogram.
+ *
+ * Values below 32 get a bucket each, above that every power of two is split into 32 buckets,
+ * so a quantile read back is at most ~3% off the recorded value while the whole range up
+ * to 2^40 needs about a thousand counters. Larger values are counted as 2^40 - 1.
+ */
+class AC_COMMON_API MetricHistogram
+{
+public:
+    static constexpr uint32 SubBucketBits = 5;
+    static constexpr uint32 SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32 ValueBits = 40;
+    static constexpr uint64 MaxValue = (uint64(1) << ValueBits) - 1;
+    static constexpr std::size_t BucketCount = (ValueBits - SubBucketBits + 1) * SubBucketCount;
+
+    using Counts = std::vector<uint64>;
+
+    MetricHistogram() = default;
+
+    MetricHistogram(MetricHistogram const&) = delete;
+    MetricHistogram& operator=(MetricHistogram const&) = delete;
+
+    void Record(uint64 value);
+
+    [[nodiscard]] uint64 GetCount() const { return _count.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetSum() const { return _sum.load(std::memory_order_relaxed); }
+
+    //! Counts of all buckets, subtracting two snapshots gives the histogram of the values recorded in between
+    [[nodiscard]] Counts GetCounts() const;
+
+    //! Value below which the given fraction (0..1) of the counted values lies, 0 if nothing was counted
+    static uint64 GetValueAtQuantile(Counts const& counts, double quantile);
+
+    static std::size_t GetBucketIndex(uint64 value);
+
+    //! Value reported for everything counted in the bucket, the middle of its range
+    static uint64 GetBucketValue(std::size_t index);
+
+private:
+    std::array<std::atomic<uint64>, BucketCount> _buckets{};
+    std::atomic<uint64> _count{0};
+    std::atomic<uint64> _sum{0};
+};
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <unordered_map>
+
+struct ProfilerThreadData
+{
+    struct Frame
+    {
+        std::size_t PathLength;
+        TimePoint Start;
+        std::chrono::nanoseconds Children;
+    };
+
+    // Only used by the owning thread
+    std::string Path;
+    std::vector<Frame> Frames;
+
+    std::mutex Lock;
+    uint32 Generation = 0;
+    std::unordered_map<std::string, std::chrono::nanoseconds> Samples;
+};
+
+namespace
+{
+    thread_local std::shared_ptr<ProfilerThreadData> ThreadData;
+}
+
+std::atomic<bool> Profiler::_capturing{false};
+
+Profiler* Profiler::instance()
+{
+    static Profiler instance;
+    return &instance;
+}
+
+void Profiler::Start()
+{
+    std::lock_guard<std::mutex> guard(_threadsLock);
+
+    // Only the list still refers to the data of threads that exited
+    std::erase_if(_threads, [](std::shared_ptr<ProfilerThreadData> const& data) { return data.use_count() == 1; });
+
+    ++_generation;
+    _startTime = std::chrono::steady_clock::now();
+    _capturing = true;
+}
+
+Profiler::Stacks Profiler::Stop()
+{
+    _capturing = false;
+
+    std::map<std::string, std::chrono::nanoseconds> merged;
+    {
+        std::lock_guard<std::mutex> guard(_threadsLock);
+        for (std::shared_ptr<ProfilerThreadData> const& data : _threads)
+        {
+            std::lock_guard<std::mutex> dataGuard(data->Lock);
+            if (data->Generation != _generation)
+                continue;
+
+            for (auto const& [stack, time] : data->Samples)
+                merged[stack] += time;
+        }
+    }
+
+    Stacks stacks;
+    stacks.reserve(merged.size());
+    for (auto const& [stack, time] : merged)
+        if (uint64 const us = std::chrono::duration_cast<Microseconds>(time).count())
+            stacks.emplace_back(stack, us);
+
+    return stacks;
+}
+
+Milliseconds Profiler::GetCaptureTime() const
+{
+    return std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - _startTime);
+}
+
+bool Profiler::WriteCollapsed(std::string const& fileName, Stacks const& stacks)
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (!file)
+        return false;
+
+    for (auto const& [stack, us] : stacks)
+        fmt::print(file, "{} {}\n", stack, us);
+
+    return fclose(file) == 0;
+}
+
+void Profiler::Enter(std::string_view label)
+{
+    ProfilerThreadData& data = GetThreadData();
+    data.Frames.push_back({ data.Path.size(), std::chrono::steady_clock::now(), std::chrono::nanoseconds::zero() });
+
+    if (!data.Path.empty())
+        data.Path.push_back(';');
+
+    // ';' separates the frames of a collapsed stack
+    std::size_t const start = data.Path.size();
+    data.Path.append(label);
+    std::replace(data.Path.begin() + start, data.Path.end(), ';', ':');
+}
+
+void Profiler::Leave()
+{
+    ProfilerThreadData& data = GetThreadData();
+    ProfilerThreadData::Frame const frame = data.Frames.back();
+    data.Frames.pop_back();
+
+    std::chrono::nanoseconds const total = std::chrono::steady_clock::now() - frame.Start;
+    if (!data.Frames.empty())
+        data.Frames.back().Children += total;
+
+    {
+        std::lock_guard<std::mutex> guard(data.Lock);
+
+        uint32 const generation = _generation.load(std::memory_order_relaxed);
+        if (data.Generation != generation)
+        {
+            data.Samples.clear();
+            data.Generation = generation;
+        }
+
+        data.Samples[data.Path] += total - frame.Children;
+    }
+
+    data.Path.resize(frame.PathLength);
+}
+
+ProfilerThreadData& Profiler::GetThreadData()
+{
+    if (!ThreadData)
+    {
+        ThreadData = std::make_shared<ProfilerThreadData>();
+
+        std::lock_guard<std::mutex> guard(_threadsLock);
+        _threads.push_back(ThreadData);
+    }
+
+    return *ThreadData;
+}
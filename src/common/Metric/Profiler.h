@@ -0,0 +1,115 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "StringFormat.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+struct ProfilerThreadData;
+
+/**
+ * Scoped-timer profiler that is always compiled in and costs a single atomic load per scope
+ * while no capture runs.
+ *
+ * During a capture every ACORE_PROFILE_SCOPE adds its time, minus the time of the scopes
+ * nested in it, to the stack of scope labels of its thread. The result is written as
+ * collapsed stacks ("World::Update;Map 571;Spell 133 1234"), the input of flamegraph.pl
+ * and speedscope, counting microseconds.
+ */
+class AC_COMMON_API Profiler
+{
+public:
+    // Collapsed stack and the microseconds spent in it
+    using Stacks = std::vector<std::pair<std::string, uint64>>;
+
+    static Profiler* instance();
+
+    static bool IsCapturing() { return _capturing.load(std::memory_order_relaxed); }
+
+    void Start();
+
+    //! Ends the capture and returns its stacks sorted by name
+    Stacks Stop();
+
+    //! Time since the capture started
+    [[nodiscard]] Milliseconds GetCaptureTime() const;
+
+    static bool WriteCollapsed(std::string const& fileName, Stacks const& stacks);
+
+    // Used by ProfileScope
+    void Enter(std::string_view label);
+    void Leave();
+
+private:
+    ProfilerThreadData& GetThreadData();
+
+    static std::atomic<bool> _capturing;
+    std::atomic<uint32> _generation{0};
+    TimePoint _startTime;
+
+    std::mutex _threadsLock;
+    std::vector<std::shared_ptr<ProfilerThreadData>> _threads;
+};
+
+#define sProfiler Profiler::instance()
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(std::string_view label) : _entered(Profiler::IsCapturing())
+    {
+        if (_entered)
+            sProfiler->Enter(label);
+    }
+
+    // The label is only formatted while capturing
+    template<typename Arg, typename... Args>
+    ProfileScope(Acore::FormatString<Arg, Args...> fmt, Arg&& arg, Args&&... args) : _entered(Profiler::IsCapturing())
+    {
+        if (_entered)
+            sProfiler->Enter(Acore::StringFormat(fmt, std::forward<Arg>(arg), std::forward<Args>(args)...));
+    }
+
+    ~ProfileScope()
+    {
+        if (_entered)
+            sProfiler->Leave();
+    }
+
+    ProfileScope(ProfileScope const&) = delete;
+    ProfileScope& operator=(ProfileScope const&) = delete;
+
+private:
+    bool _entered;
+};
+
+#define PROFILE_DO_CONCAT(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_DO_CONCAT(a, b)
+
+#define ACORE_PROFILE_SCOPE(...) ProfileScope PROFILE_CONCAT(__ac_profile_scope, __COUNTER__)(__VA_ARGS__)
+
+#endif
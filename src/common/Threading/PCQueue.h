@@ -21,6 +21,7 @@
 #include <condition_variable>
 #include <queue>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 template <typename T>
@@ -82,6 +83,23 @@ public:
         _queue.pop();
     }
 
+    // Like WaitAndPop, but gives up at the deadline. Returns true if an element was popped.
+    template<typename Clock, typename Duration>
+    bool WaitAndPopUntil(T& value, std::chrono::time_point<Clock, Duration> const& deadline)
+    {
+        std::unique_lock<std::mutex> lock(_queueLock);
+
+        if (!_condition.wait_until(lock, deadline, [this] { return !_queue.empty() || _cancel || _shutdown; }))
+            return false;
+
+        if (_queue.empty() || _cancel)
+            return false;
+
+        value = std::move(_queue.front());
+        _queue.pop();
+        return true;
+    }
+
     // Clears the queue and immediately stops any consumers.
     void Cancel()
     {
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SPSC_RING_BUFFER_H
+#define _SPSC_RING_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+namespace Acore
+{
+    /**
+     * @brief Bounded lock-free queue for exactly one producer and one consumer thread.
+     *
+     * Elements live in a fixed array of slots that are written and read in place and reused,
+     * so elements holding buffers (e.g. strings) keep their capacity and pushing does not
+     * allocate once they grew large enough.
+     */
+    template<typename T>
+    class SPSCRingBuffer
+    {
+    public:
+        explicit SPSCRingBuffer(std::size_t capacity) :
+            _slots(std::bit_ceil(std::max<std::size_t>(capacity, 2))), _mask(_slots.size() - 1) { }
+
+        SPSCRingBuffer(SPSCRingBuffer const&) = delete;
+        SPSCRingBuffer& operator=(SPSCRingBuffer const&) = delete;
+
+        /**
+         * @brief Producer only. Calls fill with the next free slot to write the element.
+         *
+         * @return false without calling fill if the buffer is full.
+         */
+        template<typename Fill>
+        bool Push(Fill&& fill)
+        {
+            std::size_t const head = _head.load(std::memory_order_relaxed);
+            if (head - _cachedTail == _slots.size())
+            {
+                _cachedTail = _tail.load(std::memory_order_acquire);
+                if (head - _cachedTail == _slots.size())
+                    return false;
+            }
+
+            fill(_slots[head & _mask]);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer only. Calls consume for every element pushed so far, oldest first.
+         *
+         * @return Number of elements consumed.
+         */
+        template<typename Fn>
+        std::size_t Consume(Fn&& consume)
+        {
+            std::size_t const tail = _tail.load(std::memory_order_relaxed);
+            std::size_t const head = _head.load(std::memory_order_acquire);
+
+            for (std::size_t i = tail; i != head; ++i)
+                consume(_slots[i & _mask]);
+
+            _tail.store(head, std::memory_order_release);
+            return head - tail;
+        }
+
+        [[nodiscard]] std::size_t Size() const
+        {
+            // Tail first, the head can only have moved further since
+            std::size_t const tail = _tail.load(std::memory_order_acquire);
+            return _head.load(std::memory_order_acquire) - tail;
+        }
+
+        [[nodiscard]] std::size_t Capacity() const { return _slots.size(); }
+
+    private:
+        std::vector<T> _slots;
+        std::size_t const _mask;
+
+        // Written by the producer, the consumer only reads it
+        alignas(64) std::atomic<std::size_t> _head{0};
+        std::size_t _cachedTail = 0;
+
+        // Written by the consumer, the producer only reads it
+        alignas(64) std::atomic<std::size_t> _tail{0};
+    };
+}
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskGraph.h"
+#include "Errors.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+Acore::TaskGraph::TaskId Acore::TaskGraph::AddTask(std::string name, std::function<void()> function, std::initializer_list<TaskId> dependencies)
+{
+    TaskId const id = _tasks.size();
+
+    Task& task = _tasks.emplace_back();
+    task.Name = std::move(name);
+    task.Function = std::move(function);
+
+    for (TaskId dependency : dependencies)
+        AddDependency(id, dependency);
+
+    return id;
+}
+
+void Acore::TaskGraph::AddDependency(TaskId task, TaskId dependency)
+{
+    ASSERT(dependency < task && task < _tasks.size(), "Task graph dependencies must point to tasks added earlier");
+
+    std::vector<TaskId>& dependencies = _tasks[task].Dependencies;
+    if (std::find(dependencies.begin(), dependencies.end(), dependency) != dependencies.end())
+        return;
+
+    dependencies.push_back(dependency);
+    _tasks[dependency].Dependents.push_back(task);
+}
+
+void Acore::TaskGraph::Run(uint32 threadCount)
+{
+    if (!threadCount)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    threadCount = std::min<uint32>(threadCount, _tasks.size());
+
+    std::mutex lock;
+    std::condition_variable wakeUp;
+
+    // Ready tasks are handed out lowest id first so a single thread keeps the declaration order
+    std::set<TaskId> ready;
+    std::vector<std::size_t> pendingDependencies(_tasks.size());
+    std::size_t unfinished = _tasks.size();
+
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        pendingDependencies[id] = _tasks[id].Dependencies.size();
+        if (!pendingDependencies[id])
+            ready.insert(id);
+    }
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true)
+        {
+            wakeUp.wait(guard, [&]() { return !ready.empty() || !unfinished; });
+            if (!unfinished)
+                return;
+
+            TaskId const id = *ready.begin();
+            ready.erase(ready.begin());
+
+            guard.unlock();
+
+            Task& task = _tasks[id];
+            TimePoint start = std::chrono::steady_clock::now();
+            task.Function();
+            task.Time = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+
+            guard.lock();
+
+            --unfinished;
+            for (TaskId dependent : task.Dependents)
+                if (!--pendingDependencies[dependent])
+                    ready.insert(dependent);
+
+            wakeUp.notify_all();
+        }
+    };
+
+    TimePoint start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32 i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    _runTime = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+Microseconds Acore::TaskGraph::GetTotalTime() const
+{
+    Microseconds total = 0us;
+    for (Task const& task : _tasks)
+        total += task.Time;
+
+    return total;
+}
+
+std::vector<Acore::TaskGraph::TaskId> Acore::TaskGraph::GetCriticalPath() const
+{
+    std::vector<TaskId> path;
+    if (_tasks.empty())
+        return path;
+
+    // Dependencies always have lower ids, one pass in id order sees every chain complete
+    std::vector<Microseconds> finish(_tasks.size());
+    std::vector<TaskId> previous(_tasks.size());
+    TaskId last = 0;
+
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        Microseconds start = 0us;
+        previous[id] = id;
+        for (TaskId dependency : _tasks[id].Dependencies)
+        {
+            if (finish[dependency] > start)
+            {
+                start = finish[dependency];
+                previous[id] = dependency;
+            }
+        }
+
+        finish[id] = start + _tasks[id].Time;
+        if (finish[id] >= finish[last])
+            last = id;
+    }
+
+    for (TaskId id = last; ; id = previous[id])
+    {
+        path.push_back(id);
+        if (previous[id] == id)
+            break;
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
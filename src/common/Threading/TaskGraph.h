@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TASK_GRAPH_H
+#define _TASK_GRAPH_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Acore
+{
+    // Runs a set of tasks with explicit dependencies between them.
+    // A task only starts after all of its dependencies finished, tasks without a path
+    // between them may run at the same time. Dependencies can only point to tasks added
+    // earlier, so the graph is acyclic by construction and running it on a single thread
+    // executes the tasks exactly in the order they were added.
+    class AC_COMMON_API TaskGraph
+    {
+    public:
+        using TaskId = std::size_t;
+
+        TaskId AddTask(std::string name, std::function<void()> function, std::initializer_list<TaskId> dependencies = {});
+        void AddDependency(TaskId task, TaskId dependency);
+
+        // Runs all tasks on up to threadCount threads, the calling thread included (0 = one per CPU core)
+        void Run(uint32 threadCount);
+
+        [[nodiscard]] std::size_t GetSize() const { return _tasks.size(); }
+        [[nodiscard]] std::string const& GetName(TaskId task) const { return _tasks[task].Name; }
+        [[nodiscard]] Microseconds GetTime(TaskId task) const { return _tasks[task].Time; }
+
+        // Wall clock time of the last Run
+        [[nodiscard]] Microseconds GetRunTime() const { return _runTime; }
+
+        // Time of all tasks added up, what running them one after another would have cost
+        [[nodiscard]] Microseconds GetTotalTime() const;
+
+        // Chain of dependent tasks with the highest summed time, the lower bound of Run no matter the thread count
+        [[nodiscard]] std::vector<TaskId> GetCriticalPath() const;
+
+    private:
+        struct Task
+        {
+            std::string Name;
+            std::function<void()> Function;
+            std::vector<TaskId> Dependencies;
+            std::vector<TaskId> Dependents;
+            Microseconds Time = 0us;
+        };
+
+        std::vector<Task> _tasks;
+        Microseconds _runTime = 0us;
+    };
+}
+
+#endif
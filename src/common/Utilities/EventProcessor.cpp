@@ -17,6 +17,8 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
+#include <bit>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -32,6 +34,214 @@ void BasicEvent::SetAborted()
     m_abortState = AbortState::STATE_ABORTED;
 }
 
+bool EventMultimapQueue::Remove(BasicEvent* event)
+{
+    auto bounds = _events.equal_range(event->m_execTime);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second != event)
+            continue;
+
+        _events.erase(itr);
+        return true;
+    }
+
+    return false;
+}
+
+BasicEvent* EventMultimapQueue::PopDue(uint64 time)
+{
+    auto itr = _events.begin();
+    if (itr == _events.end() || itr->first > time)
+        return nullptr;
+
+    BasicEvent* event = itr->second;
+    _events.erase(itr);
+    return event;
+}
+
+void EventTimingWheel::Insert(BasicEvent* event)
+{
+    if (!_slots)
+        _slots = std::make_unique<std::array<EventWheelLink*, TOTAL_SLOTS>>();
+
+    event->m_wheelSequence = ++_sequence;
+    Place(event);
+}
+
+bool EventTimingWheel::Remove(BasicEvent* event)
+{
+    if (!event->m_wheelNext)
+        return false;
+
+    Unlink(event);
+    return true;
+}
+
+BasicEvent* EventTimingWheel::PopDue(uint64 time)
+{
+    while (_cursor <= time)
+    {
+        if (!_size)
+        {
+            _cursor = time + 1;
+            break;
+        }
+
+        uint32 index = _cursor & LEVEL_MASK;
+        if (EventWheelLink* head = (*_slots)[index])
+        {
+            BasicEvent* event = static_cast<BasicEvent*>(head);
+            Unlink(event);
+            return event;
+        }
+
+        // Skip straight to the next occupied slot of the first level, stopping at
+        // the end of its turn where the next slot of the upper level is cascaded down
+        uint64 boundary = (_cursor | LEVEL_MASK) + 1;
+        uint64 limit = std::min(time + 1, boundary);
+        uint32 lastIndex = (limit - 1) & LEVEL_MASK;
+
+        uint64 candidates = _occupied[0] & ~((uint64(2) << index) - 1) & ((uint64(2) << lastIndex) - 1);
+        if (candidates)
+        {
+            _cursor += std::countr_zero(candidates) - index;
+            continue;
+        }
+
+        _cursor = limit;
+        if (_cursor == boundary)
+            Cascade();
+    }
+
+    return nullptr;
+}
+
+void EventTimingWheel::Place(BasicEvent* event)
+{
+    uint64 time = std::max(event->m_execTime, _cursor);
+    uint64 delta = time - _cursor;
+    if (delta > MAX_DELTA)
+    {
+        // Parked in the last level, placed again with its real time once cascaded
+        time = _cursor + MAX_DELTA;
+        delta = MAX_DELTA;
+    }
+
+    uint32 level = 0;
+    while (delta >> ((level + 1) * LEVEL_BITS))
+        ++level;
+
+    uint32 slot = level * LEVEL_SLOTS + ((time >> (level * LEVEL_BITS)) & LEVEL_MASK);
+
+    // Only first level slots are executed, keep them in (time, insertion) order
+    Link(event, slot, level == 0);
+}
+
+void EventTimingWheel::Link(BasicEvent* event, uint32 slot, bool sorted)
+{
+    EventWheelLink*& head = (*_slots)[slot];
+    event->m_wheelSlot = slot;
+    ++_size;
+
+    if (!head)
+    {
+        event->m_wheelPrev = event;
+        event->m_wheelNext = event;
+        head = event;
+        _occupied[slot / LEVEL_SLOTS] |= uint64(1) << (slot & LEVEL_MASK);
+        return;
+    }
+
+    auto precedes = [](BasicEvent const* left, BasicEvent const* right)
+    {
+        if (left->m_execTime != right->m_execTime)
+            return left->m_execTime < right->m_execTime;
+
+        return left->m_wheelSequence < right->m_wheelSequence;
+    };
+
+    // Walk back from the tail, new events almost always go last
+    EventWheelLink* after = head->m_wheelPrev;
+    bool newHead = false;
+    if (sorted)
+    {
+        while (precedes(event, static_cast<BasicEvent*>(after)))
+        {
+            if (after == head)
+            {
+                newHead = true;
+                after = head->m_wheelPrev;
+                break;
+            }
+
+            after = after->m_wheelPrev;
+        }
+    }
+
+    event->m_wheelPrev = after;
+    event->m_wheelNext = after->m_wheelNext;
+    after->m_wheelNext->m_wheelPrev = event;
+    after->m_wheelNext = event;
+
+    if (newHead)
+        head = event;
+}
+
+void EventTimingWheel::Unlink(BasicEvent* event)
+{
+    uint32 slot = event->m_wheelSlot;
+    EventWheelLink*& head = (*_slots)[slot];
+
+    if (event->m_wheelNext == event)
+    {
+        head = nullptr;
+        _occupied[slot / LEVEL_SLOTS] &= ~(uint64(1) << (slot & LEVEL_MASK));
+    }
+    else
+    {
+        event->m_wheelPrev->m_wheelNext = event->m_wheelNext;
+        event->m_wheelNext->m_wheelPrev = event->m_wheelPrev;
+
+        if (head == event)
+            head = event->m_wheelNext;
+    }
+
+    event->m_wheelPrev = nullptr;
+    event->m_wheelNext = nullptr;
+    --_size;
+}
+
+void EventTimingWheel::Cascade()
+{
+    for (uint32 level = 1; level < LEVELS; ++level)
+    {
+        uint32 index = (_cursor >> (level * LEVEL_BITS)) & LEVEL_MASK;
+        uint32 slot = level * LEVEL_SLOTS + index;
+
+        // Detach the whole slot first, clamped events may be placed back into this level
+        EventWheelLink* link = (*_slots)[slot];
+        if (link)
+        {
+            (*_slots)[slot] = nullptr;
+            _occupied[level] &= ~(uint64(1) << index);
+            link->m_wheelPrev->m_wheelNext = nullptr;
+
+            while (link)
+            {
+                EventWheelLink* next = link->m_wheelNext;
+                --_size;
+                Place(static_cast<BasicEvent*>(link));
+                link = next;
+            }
+        }
+
+        // Upper levels only move when this one wrapped around as well
+        if (index)
+            break;
+    }
+}
+
 EventProcessor::~EventProcessor()
 {
     KillAllEvents(true);
@@ -43,13 +253,8 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (BasicEvent* event = m_events.PopDue(m_time))
     {
-        // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
-
         if (event->IsRunning())
         {
             if (event->Execute(m_time, p_time))
@@ -81,56 +286,37 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    m_events.DeleteIf([this, force](BasicEvent* event)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
-            continue;
-        }
-
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
-    }
-
-    if (force)
-        m_events.clear();
+        return force || event->IsDeletable();
+    });
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    m_events.DeleteIf([this, group](BasicEvent* event)
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
-            continue;
-        }
+        if (event->m_eventGroup != group)
+            return false;
 
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
-    }
+        return true;
+    });
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime, uint8 eventGroup)
@@ -139,21 +325,16 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    m_events.Insert(Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    if (!m_events.Remove(event))
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    event->m_execTime = newTime.count();
+    m_events.Insert(event);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -21,15 +21,30 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
+#include <array>
 #include <map>
+#include <memory>
 
 class EventProcessor;
+class EventMultimapQueue;
+class EventTimingWheel;
+
+// Intrusive list hook used by EventTimingWheel, so queuing an event never allocates
+struct EventWheelLink
+{
+    EventWheelLink* m_wheelPrev{nullptr};
+    EventWheelLink* m_wheelNext{nullptr};
+    uint64 m_wheelSequence{0};
+    uint16 m_wheelSlot{0};
+};
 
 // Note. All times are in milliseconds here.
-class BasicEvent
+class BasicEvent : private EventWheelLink
 {
 
     friend class EventProcessor;
+    friend class EventMultimapQueue;
+    friend class EventTimingWheel;
 
     enum class AbortState : uint8
     {
@@ -90,7 +105,118 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Events ordered by execution time, ties keep insertion order
+class EventMultimapQueue
+{
+    public:
+        void Insert(BasicEvent* event) { _events.emplace(event->m_execTime, event); }
+        bool Remove(BasicEvent* event);
+
+        // Unlinks and returns the first event due at or before time
+        BasicEvent* PopDue(uint64 time);
+
+        // Deletes every queued event for which pred returns true
+        template<typename Pred>
+        void DeleteIf(Pred&& pred)
+        {
+            for (auto itr = _events.begin(); itr != _events.end();)
+            {
+                if (!pred(itr->second))
+                {
+                    ++itr;
+                    continue;
+                }
+
+                delete itr->second;
+                itr = _events.erase(itr);
+            }
+        }
+
+        [[nodiscard]] bool Empty() const { return _events.empty(); }
+
+    private:
+        std::multimap<uint64, BasicEvent*> _events;
+};
+
+// Hierarchical timing wheel with the same ordering guarantees as EventMultimapQueue.
+// Each level has 32 slots, the first one with a resolution of 1ms and every next one
+// covering a full turn of the level below; slots are cascaded down when the lower level wraps.
+// Events are linked through their own EventWheelLink, so Insert, Remove and PopDue never allocate.
+class EventTimingWheel
+{
+    public:
+        EventTimingWheel() = default;
+
+        EventTimingWheel(EventTimingWheel const&) = delete;
+        EventTimingWheel& operator=(EventTimingWheel const&) = delete;
+
+        void Insert(BasicEvent* event);
+        bool Remove(BasicEvent* event);
+
+        // Unlinks and returns the first event due at or before time
+        BasicEvent* PopDue(uint64 time);
+
+        // Deletes every queued event for which pred returns true
+        template<typename Pred>
+        void DeleteIf(Pred&& pred)
+        {
+            if (!_slots)
+                return;
+
+            for (uint32 slot = 0; slot < TOTAL_SLOTS; ++slot)
+            {
+                EventWheelLink* link = (*_slots)[slot];
+                if (!link)
+                    continue;
+
+                // events linked by pred callbacks end up after last and are not visited
+                EventWheelLink* last = link->m_wheelPrev;
+                bool done = false;
+                while (!done)
+                {
+                    done = link == last;
+                    EventWheelLink* next = link->m_wheelNext;
+
+                    BasicEvent* event = static_cast<BasicEvent*>(link);
+                    if (pred(event))
+                    {
+                        Unlink(event);
+                        delete event;
+                    }
+
+                    link = next;
+                }
+            }
+        }
+
+        [[nodiscard]] bool Empty() const { return _size == 0; }
+
+    private:
+        static constexpr uint32 LEVEL_BITS = 5;
+        static constexpr uint32 LEVEL_SLOTS = 1 << LEVEL_BITS;
+        static constexpr uint32 LEVEL_MASK = LEVEL_SLOTS - 1;
+        static constexpr uint32 LEVELS = 6;                   // 2^30ms (~12 days), later events are cascaded again
+        static constexpr uint32 TOTAL_SLOTS = LEVELS * LEVEL_SLOTS;
+        static constexpr uint64 MAX_DELTA = (uint64(1) << (LEVELS * LEVEL_BITS)) - 1;
+
+        void Place(BasicEvent* event);
+        void Link(BasicEvent* event, uint32 slot, bool sorted);
+        void Unlink(BasicEvent* event);
+        void Cascade();
+
+        // Slot heads are only allocated once the first event is queued, most objects never get one
+        std::unique_ptr<std::array<EventWheelLink*, TOTAL_SLOTS>> _slots;
+        std::array<uint64, LEVELS> _occupied{};
+        uint64 _cursor{0};
+        uint64 _sequence{0};
+        std::size_t _size{0};
+};
+
+#ifdef EVENT_TIMING_WHEEL
+typedef EventTimingWheel EventList;
+#else
+typedef EventMultimapQueue EventList;
+#endif
 
 class EventProcessor
 {
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::unique_ptr<Acore::MappedFile> Acore::MappedFile::Open(std::string const& fileName, Access access /*= Access::ReadOnly*/)
+{
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || !fileSize.QuadPart)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, access == Access::CopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return nullptr;
+
+    // the view keeps the mapping object alive after its handle is closed
+    void* data = MapViewOfFile(mapping, access == Access::CopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+        return nullptr;
+
+    std::size_t const size = std::size_t(fileSize.QuadPart);
+#else
+    int fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    std::size_t const fileSize = std::size_t(st.st_size);
+    int const protection = access == Access::CopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* data = mmap(nullptr, fileSize, protection, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    std::size_t const size = fileSize;
+#endif
+
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<uint8*>(data), size, access));
+}
+
+Acore::MappedFile::~MappedFile()
+{
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    UnmapViewOfFile(_data);
+#else
+    munmap(_data, _size);
+#endif
+}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include "Define.h"
+#include <memory>
+#include <string>
+
+namespace Acore
+{
+    /// Read-only view of a whole file mapped into the address space.
+    /// Pages are backed by the OS page cache, so every process mapping the
+    /// same file shares one physical copy of the data.
+    class AC_COMMON_API MappedFile
+    {
+    public:
+        enum class Access
+        {
+            ReadOnly,
+            CopyOnWrite     // writable, modified pages become private to this process
+        };
+
+        /// Returns nullptr if the file cannot be opened or is empty.
+        static std::unique_ptr<MappedFile> Open(std::string const& fileName, Access access = Access::ReadOnly);
+
+        ~MappedFile();
+
+        MappedFile(MappedFile const&) = delete;
+        MappedFile& operator=(MappedFile const&) = delete;
+
+        [[nodiscard]] uint8 const* GetData() const { return _data; }
+        [[nodiscard]] uint8* GetWritableData() const { return _access == Access::CopyOnWrite ? _data : nullptr; }
+        [[nodiscard]] std::size_t GetSize() const { return _size; }
+
+    private:
+        MappedFile(uint8* data, std::size_t size, Access access) : _data(data), _size(size), _access(access) { }
+
+        uint8* _data;
+        std::size_t _size;
+        Access _access;
+    };
+}
+
+#endif
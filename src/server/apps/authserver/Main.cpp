@@ -86,7 +86,7 @@ int main(int argc, char** argv)
 
     // Init logging
     sLog->RegisterAppender<AppenderDB>();
-    sLog->Initialize(nullptr);
+    sLog->Initialize();
 
     Acore::Banner::Show("authserver",
         [](std::string_view text)
@@ -128,6 +128,13 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> dbHandle(nullptr, [](void*) { StopDB(); });
 
+    std::string ioBackendError;
+    if (!Acore::Asio::IsBackendAvailable(ioBackendError))
+    {
+        printf("io_uring is not available (%s). Allow io_uring for the process or rebuild with WITH_IO_URING=0.\n", ioBackendError.c_str());
+        return 1;
+    }
+
     std::shared_ptr<Acore::Asio::IoContext> ioContext = std::make_shared<Acore::Asio::IoContext>();
 
     // Get the list of realms for the server
@@ -28,6 +28,7 @@
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
+#include "DBUpdater.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
@@ -37,8 +38,10 @@
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
 #include "MySQLThreading.h"
+#include "ObjectAccessor.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
+#include "PlayerSaveCache.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "RealmList.h"
@@ -183,12 +186,19 @@ int main(int argc, char** argv)
     if (!sConfigMgr->LoadAppConfigs())
         return 1;
 
+    std::string ioBackendError;
+    if (!Acore::Asio::IsBackendAvailable(ioBackendError))
+    {
+        printf("io_uring is not available (%s). Allow io_uring for the process or rebuild with WITH_IO_URING=0.\n", ioBackendError.c_str());
+        return 1;
+    }
+
     std::shared_ptr<Acore::Asio::IoContext> ioContext = std::make_shared<Acore::Asio::IoContext>();
 
     // Init all logs
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
-    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    // With async logging the messages are written by a logging thread of its own
+    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false));
 
     Acore::Banner::Show("worldserver-daemon",
         [](std::string_view text)
@@ -287,9 +297,22 @@ int main(int argc, char** argv)
     sMetric->Initialize(realm.Name, *ioContext, []()
     {
         METRIC_VALUE("online_players", sWorldSessionMgr->GetPlayerCount());
+        METRIC_VALUE("active_sessions", sWorldSessionMgr->GetActiveSessionCount());
+        METRIC_VALUE("queued_sessions", sWorldSessionMgr->GetQueuedSessionCount());
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        HashMapHolderStats playerStats = HashMapHolder<Player>::GetStats();
+        METRIC_VALUE("object_accessor_lookups", playerStats.Lookups);
+        METRIC_VALUE("object_accessor_contended_lookups", playerStats.ContendedLookups);
+        METRIC_VALUE("object_accessor_writes", playerStats.Writes);
+        METRIC_VALUE("object_accessor_contended_writes", playerStats.ContendedWrites);
+        METRIC_VALUE("object_accessor_write_lock_ns", playerStats.WriteLockHoldTimeNs);
+
+        PlayerSaveCacheStats saveStats = PlayerSaveCache::GetStats();
+        METRIC_VALUE("player_save_skipped_statements", saveStats.SkippedStatements);
+        METRIC_VALUE("player_save_skipped_bytes", saveStats.SkippedBytes);
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -302,10 +325,17 @@ int main(int argc, char** argv)
 
     Acore::Module::SetEnableModulesList(AC_MODULES_LIST);
 
+    ///- Serve the world tables from the snapshot of the last start while the world loads
+    std::string const worldSnapshotFile = sConfigMgr->GetOption<std::string>("WorldDatabase.SnapshotFile", "");
+    if (!worldSnapshotFile.empty())
+        WorldDatabase.OpenSnapshot(worldSnapshotFile, DBUpdater<WorldDatabaseConnection>::GetStateHash(WorldDatabase));
+
     ///- Initialize the World
     sSecretMgr->Initialize();
     sWorld->SetInitialWorldSettings();
 
+    WorldDatabase.CloseSnapshot();
+
     std::shared_ptr<void> mapManagementHandle(nullptr, [](void*)
     {
         // unload battleground templates before different singletons destroyed
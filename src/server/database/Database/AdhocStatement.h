@@ -30,6 +30,8 @@ public:
     ~BasicStatementTask();
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override { return !m_has_result; }
+    [[nodiscard]] uint32 GetStatementId() const override { return SQL_STATEMENT_ID_ADHOC; }
     QueryResultFuture GetFuture() const { return m_result->get_future(); }
 
 private:
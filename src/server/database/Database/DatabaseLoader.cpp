@@ -53,9 +53,22 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
             return false;
         }
 
+        uint8 const maxAsyncThreads = sConfigMgr->GetOption<uint8>(name + "Database.MaxWorkerThreads", 0);
+        if (maxAsyncThreads > 32)
+        {
+            LOG_ERROR(_logger, "{} database: invalid maximum number of worker threads specified. "
+                      "Please pick a value between 0 and 32.", name);
+            return false;
+        }
+
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetBatching(sConfigMgr->GetOption<uint32>(name + "Database.BatchSize", 1),
+            Milliseconds(sConfigMgr->GetOption<uint32>(name + "Database.BatchDelay", 0)));
+        pool.SetAsyncScaling(maxAsyncThreads);
+        pool.SetResultCache(sConfigMgr->GetOption<uint32>(name + "Database.ResultCache.Size", 0),
+            Seconds(sConfigMgr->GetOption<uint32>(name + "Database.ResultCache.Lifetime", 300)));
 
         if (uint32 error = pool.Open())
         {
@@ -15,20 +15,25 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "LogOperation.h"
-#include "LogMessage.h"
-#include "Logger.h"
+#include "DatabaseQueueStats.h"
+#include <algorithm>
 
-LogOperation::LogOperation(Logger const* _logger, std::unique_ptr<LogMessage>&& _msg) : logger(_logger), msg(std::forward<std::unique_ptr<LogMessage>>(_msg))
+void DatabaseQueueStats::Record(uint32 statementId, Microseconds waitTime, Microseconds executeTime)
 {
-}
+    std::lock_guard<std::mutex> guard(_lock);
 
-LogOperation::~LogOperation()
-{
+    DatabaseQueueStatsEntry& entry = _entries[statementId];
+    ++entry.Count;
+    entry.WaitTime += waitTime;
+    entry.MaxWaitTime = std::max(entry.MaxWaitTime, waitTime);
+    entry.ExecuteTime += executeTime;
 }
 
-int LogOperation::call()
+DatabaseQueueStats::Entries DatabaseQueueStats::Collect()
 {
-    logger->write(msg.get());
-    return 0;
+    Entries entries;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    entries.swap(_entries);
+    return entries;
 }
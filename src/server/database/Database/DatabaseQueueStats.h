@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASEQUEUESTATS_H
+#define _DATABASEQUEUESTATS_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <mutex>
+#include <unordered_map>
+
+struct DatabaseQueueStatsEntry
+{
+    uint64 Count = 0;
+    Microseconds WaitTime = 0us;        // spent in the queue, summed over all operations
+    Microseconds MaxWaitTime = 0us;
+    Microseconds ExecuteTime = 0us;     // spent executing, summed over all operations
+};
+
+/**
+    @class DatabaseQueueStats
+    @brief Time the operations of an async queue spend waiting and executing, per statement id.
+
+    Filled by the worker threads, collected and reset by the pool.
+*/
+class AC_DATABASE_API DatabaseQueueStats
+{
+public:
+    using Entries = std::unordered_map<uint32, DatabaseQueueStatsEntry>;
+
+    void Record(uint32 statementId, Microseconds waitTime, Microseconds executeTime);
+
+    //! Returns everything recorded since the last call
+    Entries Collect();
+
+private:
+    std::mutex _lock;
+    Entries _entries;
+};
+
+#endif
@@ -16,10 +16,15 @@
  */
 
 #include "DatabaseWorker.h"
+#include "DatabaseQueueStats.h"
+#include "Metric.h"
+#include "MySQLConnection.h"
 #include "PCQueue.h"
 #include "SQLOperation.h"
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection, MySQLConnectionInfo const& connectionInfo) :
+    _batchSize(connectionInfo.batchSize), _batchDelay(connectionInfo.batchDelay), _databaseName(connectionInfo.database),
+    _lastReport(std::chrono::steady_clock::now())
 {
     _connection = connection;
     _queue = newQueue;
@@ -42,12 +47,160 @@ void DatabaseWorker::WorkerThread()
 
         _queue->WaitAndPop(operation);
 
+        // Shutdown, or the pool is shrinking and this worker got the stop request
         if (!operation)
-            return;
+            break;
 
+        if (_batchSize > 1 && operation->IsBatchable())
+        {
+            SQLOperation* next = nullptr;
+            if (!ExecuteBatch(operation, next))
+                continue;
+
+            if (!next)
+                break;
+
+            operation = next;
+        }
+
+        Execute(operation);
+    }
+
+    _finished = true;
+}
+
+void DatabaseWorker::Execute(SQLOperation* operation)
+{
+    TimePoint const start = std::chrono::steady_clock::now();
+
+    operation->SetConnection(_connection);
+    operation->call();
+
+    RecordTimes(operation, start, std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start));
+
+    delete operation;
+}
+
+bool DatabaseWorker::ExecuteBatch(SQLOperation* first, SQLOperation*& next)
+{
+    std::vector<SQLOperation*> batch = { first };
+    bool popped = false;
+
+    TimePoint const deadline = std::chrono::steady_clock::now() + _batchDelay;
+    while (batch.size() < _batchSize)
+    {
+        SQLOperation* operation = nullptr;
+        if (!_queue->Pop(operation) && (_batchDelay <= 0ms || !_queue->WaitAndPopUntil(operation, deadline)))
+            break;
+
+        if (!operation || !operation->IsBatchable())
+        {
+            next = operation;
+            popped = true;
+            break;
+        }
+
+        batch.push_back(operation);
+    }
+
+    if (batch.size() == 1)
+    {
+        Execute(first);
+        LogBatchMetrics(1, 1);
+        return popped;
+    }
+
+    for (SQLOperation* operation : batch)
         operation->SetConnection(_connection);
-        operation->call();
 
-        delete operation;
+    TimePoint const start = std::chrono::steady_clock::now();
+
+    _connection->BeginTransaction();
+    uint32 const reconnects = _connection->GetReconnectCount();
+
+    std::size_t executed = 0;
+    bool failed = false;
+    for (; executed < batch.size(); ++executed)
+    {
+        if (!batch[executed]->Execute())
+        {
+            failed = true;
+            break;
+        }
+
+        if (_connection->GetReconnectCount() != reconnects)
+            break;
     }
+
+    if (_connection->GetReconnectCount() != reconnects)
+    {
+        // The transaction was rolled back with the dropped connection. The statement that ran into it
+        // was retried on the new connection on its own, run the others the same way.
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            if (i != executed)
+                batch[i]->call();
+
+        LogBatchMetrics(batch.size(), batch.size());
+    }
+    else if (failed)
+    {
+        // One failing statement must not take the others down with it, run them on their own as without batching
+        _connection->RollbackTransaction();
+        for (SQLOperation* operation : batch)
+            operation->call();
+
+        LogBatchMetrics(batch.size(), batch.size() + 1);
+    }
+    else
+    {
+        _connection->CommitTransaction();
+
+        // Connection dropped before the commit went through, the batch was lost with it
+        if (_connection->GetReconnectCount() != reconnects)
+        {
+            for (SQLOperation* operation : batch)
+                operation->call();
+
+            LogBatchMetrics(batch.size(), batch.size() + 1);
+        }
+        else
+            LogBatchMetrics(batch.size(), 1);
+    }
+
+    Microseconds const executeTime = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+    for (SQLOperation* operation : batch)
+        RecordTimes(operation, start, executeTime / int64(batch.size()));
+
+    METRIC_VALUE("db_batch_size", uint64(batch.size()), METRIC_TAG("database", _databaseName));
+    METRIC_VALUE("db_batch_time", std::chrono::nanoseconds(executeTime), METRIC_TAG("database", _databaseName));
+
+    for (SQLOperation* operation : batch)
+        delete operation;
+
+    return popped;
+}
+
+void DatabaseWorker::RecordTimes(SQLOperation const* operation, TimePoint start, Microseconds executeTime)
+{
+    if (!operation->m_queueStats)
+        return;
+
+    operation->m_queueStats->Record(operation->GetStatementId(), std::chrono::duration_cast<Microseconds>(start - operation->m_queuedTime), executeTime);
+}
+
+void DatabaseWorker::LogBatchMetrics(std::size_t statements, std::size_t commits)
+{
+    _statements += statements;
+    _commits += commits;
+
+    TimePoint const now = std::chrono::steady_clock::now();
+    if (now - _lastReport < 1s)
+        return;
+
+    // One-way statements per round trip ending in a commit, 1 without batching
+    METRIC_VALUE("db_batch_gain", double(_statements) / _commits, METRIC_TAG("database", _databaseName));
+
+    _statements = 0;
+    _commits = 0;
+    _lastReport = now;
 }
@@ -19,27 +19,52 @@
 #define _WORKERTHREAD_H
 
 #include "Define.h"
+#include "Duration.h"
 #include <atomic>
+#include <string>
 #include <thread>
+#include <vector>
 
 template <typename T>
 class ProducerConsumerQueue;
 
 class MySQLConnection;
 class SQLOperation;
+struct MySQLConnectionInfo;
 
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection, MySQLConnectionInfo const& connectionInfo);
     ~DatabaseWorker();
 
+    //! True once the thread left, after shutdown or popping a nullptr queued to stop one worker
+    [[nodiscard]] bool IsFinished() const { return _finished; }
+
 private:
     ProducerConsumerQueue<SQLOperation*>* _queue;
     MySQLConnection* _connection;
 
     void WorkerThread();
     std::thread _workerThread;
+    std::atomic<bool> _finished{};
+
+    void Execute(SQLOperation* operation);
+
+    //! Executes first and the one-way operations queued right after it in one transaction.
+    //! Returns true if it popped an operation that ended the batch, next is executed by the caller then.
+    bool ExecuteBatch(SQLOperation* first, SQLOperation*& next);
+    void LogBatchMetrics(std::size_t statements, std::size_t commits);
+    static void RecordTimes(SQLOperation const* operation, TimePoint start, Microseconds executeTime);
+
+    uint32 _batchSize;
+    Milliseconds _batchDelay;
+    std::string _databaseName;
+
+    // Statements and commits since the throughput gain was last reported
+    std::size_t _statements = 0;
+    std::size_t _commits = 0;
+    TimePoint _lastReport;
 
     DatabaseWorker(DatabaseWorker const& right) = delete;
     DatabaseWorker& operator=(DatabaseWorker const& right) = delete;
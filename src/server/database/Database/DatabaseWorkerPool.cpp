@@ -18,19 +18,26 @@
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
 #include "CharacterDatabase.h"
+#include "DatabaseQueueStats.h"
+#include "DatabaseWorker.h"
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
+#include "Metric.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
 #include "PCQueue.h"
+#include "PreparedResultCache.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
+#include "QuerySnapshot.h"
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
+#include <filesystem>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -51,9 +58,41 @@ class PingOperation : public SQLOperation
     }
 };
 
+namespace
+{
+    constexpr Milliseconds QueueReportInterval = 1s;
+
+    // Average time operations waited in the queue during a report interval for it to count as backed up or idle
+    constexpr Microseconds AsyncBacklogWait = 50ms;
+    constexpr Microseconds AsyncIdleWait = 1ms;
+
+    // How long the queue has to stay backed up before another async connection is opened,
+    // and how long it has to stay idle before one of the added connections is closed again
+    constexpr Milliseconds AsyncGrowAfter = 5s;
+    constexpr Milliseconds AsyncShrinkAfter = 1min;
+
+    std::string GetStatementMetricName(uint32 statementId)
+    {
+        switch (statementId)
+        {
+            case SQL_STATEMENT_ID_ADHOC:
+                return "adhoc";
+            case SQL_STATEMENT_ID_TRANSACTION:
+                return "transaction";
+            case SQL_STATEMENT_ID_QUERY_HOLDER:
+                return "query_holder";
+            case SQL_STATEMENT_ID_OTHER:
+                return "other";
+            default:
+                return std::to_string(statementId);
+        }
+    }
+}
+
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
+    _queueStats(std::make_unique<DatabaseQueueStats>()),
     _async_threads(0),
     _synch_threads(0)
 {
@@ -83,6 +122,28 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetBatching(uint32 maxStatements, Milliseconds maxDelay)
+{
+    WPFatal(_connectionInfo.get(), "Connection info was not set!");
+
+    _connectionInfo->batchSize = std::max<uint32>(maxStatements, 1);
+    _connectionInfo->batchDelay = maxDelay;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetAsyncScaling(uint8 maxAsyncThreads)
+{
+    _maxAsyncThreads = maxAsyncThreads;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetResultCache(std::size_t maxEntries, Seconds lifetime)
+{
+    _resultCacheSize = maxEntries;
+    _resultCacheLifetime = lifetime;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -91,6 +152,13 @@ uint32 DatabaseWorkerPool<T>::Open()
     LOG_INFO("sql.driver", "Opening DatabasePool '{}'. Asynchronous connections: {}, synchronous connections: {}.",
         GetDatabaseName(), _async_threads, _synch_threads);
 
+    if (_connectionInfo->batchSize > 1)
+        LOG_INFO("sql.driver", "Asynchronous one-way statements are batched, up to {} per transaction, waiting up to {} ms for more.",
+            _connectionInfo->batchSize, _connectionInfo->batchDelay.count());
+
+    if (_maxAsyncThreads > _async_threads)
+        LOG_INFO("sql.driver", "Up to {} asynchronous connections are opened while the queue is backed up.", _maxAsyncThreads);
+
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
     if (error)
@@ -174,16 +242,32 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
         }
     }
 
+    if (_resultCacheSize && !_resultCache)
+    {
+        _resultCache = std::make_unique<PreparedResultCache>(_resultCacheSize, _resultCacheLifetime);
+        _connections[IDX_SYNCH].front()->DoPrepareResultCache(*_resultCache);
+
+        LOG_INFO("sql.driver", "DatabasePool '{}' caches up to {} query results for {} seconds.",
+            GetDatabaseName(), _resultCacheSize, _resultCacheLifetime.count());
+    }
+
     return true;
 }
 
 template <class T>
 QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 {
-    auto connection = GetFreeConnection();
+    ResultSet* result = _snapshot ? _snapshot->Find(sql) : nullptr;
+    if (!result)
+    {
+        auto connection = GetFreeConnection();
 
-    ResultSet* result = connection->Query(sql);
-    connection->Unlock();
+        result = connection->Query(sql);
+        connection->Unlock();
+
+        if (result && _snapshot)
+            result = _snapshot->Store(sql, result);
+    }
 
     if (!result || !result->GetRowCount() || !result->NextRow())
     {
@@ -197,6 +281,20 @@ QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 template <class T>
 PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 {
+    if (_resultCache && _resultCache->IsCached(stmt->GetIndex()))
+    {
+        PreparedQueryResult result = _resultCache->Query(stmt, [this, stmt]()
+        {
+            auto connection = GetFreeConnection();
+            PreparedResultSet* ret = connection->Query(stmt);
+            connection->Unlock();
+            return ret;
+        });
+
+        delete stmt;
+        return result;
+    }
+
     auto connection = GetFreeConnection();
     PreparedResultSet* ret = connection->Query(stmt);
     connection->Unlock();
@@ -252,6 +350,8 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 template <class T>
 void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
 {
+    InvalidateSnapshot();
+
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
     //! Ideally we catch the faults in Debug mode and then correct them,
@@ -269,12 +369,18 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    TransactionTask* task = new TransactionTask(transaction);
+    if (_resultCache)
+        task->m_cacheWrite = _resultCache->BeginWrite(*transaction);
+
+    Enqueue(task);
 }
 
 template <class T>
 TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
 {
+    InvalidateSnapshot();
+
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
     //! Ideally we catch the faults in Debug mode and then correct them,
@@ -293,6 +399,9 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 #endif // ACORE_DEBUG
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
+    if (_resultCache)
+        task->m_cacheWrite = _resultCache->BeginWrite(*transaction);
+
     TransactionFuture result = task->GetFuture();
     Enqueue(task);
     return TransactionCallback(std::move(result));
@@ -301,6 +410,11 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 template <class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transaction)
 {
+    InvalidateSnapshot();
+
+    // Released when returning, after the transaction was executed
+    std::shared_ptr<void> cacheWrite = _resultCache ? _resultCache->BeginWrite(*transaction) : nullptr;
+
     T* connection = GetFreeConnection();
     int errorCode = connection->ExecuteTransaction(transaction);
 
@@ -448,6 +562,9 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
         }
         else
         {
+            if (type == IDX_ASYNC)
+                connection->StartWorker();
+
             _connections[type].push_back(std::move(connection));
         }
     }
@@ -468,6 +585,9 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
+    op->m_queuedTime = std::chrono::steady_clock::now();
+    op->m_queueStats = _queueStats.get();
+    op->m_resultCache = _resultCache.get();
     _queue->Push(op);
 }
 
@@ -477,6 +597,102 @@ std::size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queue->Size();
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::Update(uint32 diff)
+{
+    _updateTimer += diff;
+    if (_updateTimer < QueueReportInterval.count())
+        return;
+
+    uint32 const elapsed = _updateTimer;
+    _updateTimer = 0;
+
+    // Drop the connections whose worker took a stop request
+    std::size_t const connectionCount = _connections[IDX_ASYNC].size();
+    std::erase_if(_connections[IDX_ASYNC], [](std::unique_ptr<T> const& connection) { return connection->m_worker->IsFinished(); });
+    _stoppingWorkers -= std::min<std::size_t>(_stoppingWorkers, connectionCount - _connections[IDX_ASYNC].size());
+
+    std::string const database(GetDatabaseName());
+    uint64 operations = 0;
+    Microseconds waitTime = 0us;
+
+    for (auto const& [statementId, entry] : _queueStats->Collect())
+    {
+        operations += entry.Count;
+        waitTime += entry.WaitTime;
+
+        std::string const statement = GetStatementMetricName(statementId);
+        METRIC_VALUE("db_statement_count", entry.Count, METRIC_TAG("database", database), METRIC_TAG("statement", statement));
+        METRIC_VALUE("db_statement_wait_us", uint64(entry.WaitTime.count() / entry.Count), METRIC_TAG("database", database), METRIC_TAG("statement", statement));
+        METRIC_VALUE("db_statement_max_wait_us", uint64(entry.MaxWaitTime.count()), METRIC_TAG("database", database), METRIC_TAG("statement", statement));
+        METRIC_VALUE("db_statement_execute_us", uint64(entry.ExecuteTime.count() / entry.Count), METRIC_TAG("database", database), METRIC_TAG("statement", statement));
+    }
+
+    std::size_t const queueSize = _queue->Size();
+    std::size_t const workers = _connections[IDX_ASYNC].size() - _stoppingWorkers;
+    Microseconds const averageWait = operations ? waitTime / int64(operations) : 0us;
+
+    METRIC_VALUE("db_queue_wait_us", uint64(averageWait.count()), METRIC_TAG("database", database));
+    METRIC_VALUE("db_async_connections", uint64(workers), METRIC_TAG("database", database));
+
+    if (_resultCache)
+    {
+        PreparedResultCacheStats const cacheStats = _resultCache->Collect();
+        METRIC_VALUE("db_result_cache_hits", cacheStats.Hits, METRIC_TAG("database", database));
+        METRIC_VALUE("db_result_cache_misses", cacheStats.Misses, METRIC_TAG("database", database));
+        METRIC_VALUE("db_result_cache_entries", uint64(cacheStats.Entries), METRIC_TAG("database", database));
+    }
+
+    if (_maxAsyncThreads <= _async_threads)
+        return;
+
+    // Nothing finishing while operations are queued means the workers are stuck on slow ones
+    bool const backlog = queueSize && (averageWait >= AsyncBacklogWait || !operations);
+    bool const idle = !queueSize && averageWait < AsyncIdleWait;
+
+    _backlogTime = backlog ? _backlogTime + elapsed : 0;
+    _idleTime = idle ? _idleTime + elapsed : 0;
+
+    if (_backlogTime >= AsyncGrowAfter.count() && workers < _maxAsyncThreads)
+    {
+        _backlogTime = 0;
+        AddAsyncConnection();
+    }
+    else if (_idleTime >= AsyncShrinkAfter.count() && workers > _async_threads)
+    {
+        _idleTime = 0;
+        RemoveAsyncConnection();
+    }
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::AddAsyncConnection()
+{
+    auto connection = std::make_unique<T>(_queue.get(), *_connectionInfo);
+    if (connection->Open() || !connection->PrepareStatements())
+    {
+        LOG_ERROR("sql.driver", "DatabasePool '{}' is backed up but could not open another asynchronous connection.", GetDatabaseName());
+        return;
+    }
+
+    connection->StartWorker();
+    _connections[IDX_ASYNC].push_back(std::move(connection));
+
+    LOG_INFO("sql.driver", "DatabasePool '{}' is backed up, opened asynchronous connection {} of at most {}.",
+        GetDatabaseName(), _connections[IDX_ASYNC].size() - _stoppingWorkers, _maxAsyncThreads);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::RemoveAsyncConnection()
+{
+    // The worker popping it stops, its connection is closed by the next Update
+    _queue->Push(nullptr);
+    ++_stoppingWorkers;
+
+    LOG_INFO("sql.driver", "DatabasePool '{}' is idle, closing an asynchronous connection. {} remain.",
+        GetDatabaseName(), _connections[IDX_ASYNC].size() - _stoppingWorkers);
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -517,14 +733,22 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
     if (sql.empty())
         return;
 
+    InvalidateSnapshot();
     BasicStatementTask* task = new BasicStatementTask(sql);
+    if (_resultCache)
+        task->m_cacheWrite = _resultCache->BeginAdhocWrite();
+
     Enqueue(task);
 }
 
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
+    InvalidateSnapshot();
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
+    if (_resultCache)
+        task->m_cacheWrite = _resultCache->BeginWrite(stmt);
+
     Enqueue(task);
 }
 
@@ -534,6 +758,9 @@ void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
     if (sql.empty())
         return;
 
+    InvalidateSnapshot();
+    std::shared_ptr<void> cacheWrite = _resultCache ? _resultCache->BeginAdhocWrite() : nullptr;
+
     T* connection = GetFreeConnection();
     connection->Execute(sql);
     connection->Unlock();
@@ -542,6 +769,9 @@ void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
 template <class T>
 void DatabaseWorkerPool<T>::DirectExecute(PreparedStatement<T>* stmt)
 {
+    InvalidateSnapshot();
+    std::shared_ptr<void> cacheWrite = _resultCache ? _resultCache->BeginWrite(stmt) : nullptr;
+
     T* connection = GetFreeConnection();
     connection->Execute(stmt);
     connection->Unlock();
@@ -568,6 +798,55 @@ void DatabaseWorkerPool<T>::ExecuteOrAppend(SQLTransaction<T>& trans, PreparedSt
         trans->Append(stmt);
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::OpenSnapshot(std::string const& path, std::string const& state)
+{
+    _snapshot = std::make_unique<QuerySnapshot>(path, state);
+    _snapshotPath = path;
+    _snapshotInvalidated = false;
+    _snapshotWritten = false;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::CloseSnapshot()
+{
+    if (!_snapshot)
+        return;
+
+    // Results read before the write may be stale, the next start has to read the tables again
+    if (_snapshotWritten.exchange(false))
+    {
+        _snapshot.reset();
+        InvalidateSnapshot();
+        return;
+    }
+
+    _snapshot->Save();
+    _snapshot.reset();
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::InvalidateSnapshot()
+{
+    if (_snapshotPath.empty())
+        return;
+
+    // The file is still mapped and serving queries, it is dropped by CloseSnapshot()
+    if (_snapshot)
+    {
+        _snapshotWritten = true;
+        return;
+    }
+
+    if (_snapshotInvalidated.exchange(true))
+        return;
+
+    std::error_code error;
+    std::filesystem::remove(_snapshotPath, error);
+
+    LOG_INFO("sql.driver", "DatabasePool '{}' was written to, removed query snapshot {}.", GetDatabaseName(), _snapshotPath);
+}
+
 template class AC_DATABASE_API DatabaseWorkerPool<LoginDatabaseConnection>;
 template class AC_DATABASE_API DatabaseWorkerPool<WorldDatabaseConnection>;
 template class AC_DATABASE_API DatabaseWorkerPool<CharacterDatabaseConnection>;
@@ -20,8 +20,10 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
+#include <atomic>
 #include <vector>
 
 /** @file DatabaseWorkerPool.h */
@@ -41,7 +43,10 @@
 template <typename T>
 class ProducerConsumerQueue;
 
+class DatabaseQueueStats;
+class PreparedResultCache;
 class SQLOperation;
+class QuerySnapshot;
 struct MySQLConnectionInfo;
 
 template <class T>
@@ -62,6 +67,19 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Lets the async workers run up to maxStatements consecutive one-way statements in one transaction,
+    //! waiting at most maxDelay for more to arrive. A size of 1 executes every statement on its own.
+    //! Must be called after SetConnectionInfo and before Open.
+    void SetBatching(uint32 maxStatements, Milliseconds maxDelay);
+
+    //! Lets Update open async connections beyond the configured ones, up to maxAsyncThreads in total,
+    //! while operations keep waiting in the queue. 0 keeps the number of async connections fixed.
+    void SetAsyncScaling(uint8 maxAsyncThreads);
+
+    //! Keeps up to maxEntries results of the statements the connection type marks as cacheable for at most lifetime.
+    //! 0 entries disables the cache. Must be called before PrepareStatements.
+    void SetResultCache(std::size_t maxEntries, Seconds lifetime);
+
     uint32 Open();
     void Close();
 
@@ -215,6 +233,21 @@ public:
 
     [[nodiscard]] std::size_t QueueSize() const;
 
+    //! Reports the queue wait and execution times per statement and grows or shrinks the async
+    //! connections with the backlog. Must be called from one thread only, while the pool is open.
+    //! More than one async connection gives up running async operations in the order they were queued.
+    void Update(uint32 diff);
+
+    //! Serves string queries from the snapshot file at path while it is open, results it does not
+    //! have yet are fetched from the database and added. A file written for another state is rebuilt.
+    //! Must not be called while other threads run queries on this pool.
+    void OpenSnapshot(std::string const& path, std::string const& state);
+
+    //! Stops serving queries from the snapshot and writes it back if results were added.
+    //! If the database was written to while it was open the snapshot file is removed instead,
+    //! as is the case for any later write.
+    void CloseSnapshot();
+
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
@@ -222,6 +255,11 @@ private:
 
     void Enqueue(SQLOperation* op);
 
+    void AddAsyncConnection();
+    void RemoveAsyncConnection();
+
+    void InvalidateSnapshot();
+
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
     T* GetFreeConnection();
@@ -230,10 +268,27 @@ private:
 
     //! Queue shared by async worker threads.
     std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    //! Filled by the async workers, must outlive them.
+    std::unique_ptr<DatabaseQueueStats> _queueStats;
+    //! Used by the async workers, must outlive them.
+    std::unique_ptr<PreparedResultCache> _resultCache;
+    std::size_t _resultCacheSize = 0;
+    Seconds _resultCacheLifetime = 0s;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
+    std::unique_ptr<QuerySnapshot> _snapshot;
+    std::string _snapshotPath;
+    std::atomic<bool> _snapshotInvalidated{};
+    std::atomic<bool> _snapshotWritten{};
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+
+    // Async connection scaling, see Update
+    uint8 _maxAsyncThreads = 0;
+    uint8 _stoppingWorkers = 0;
+    uint32 _updateTimer = 0;
+    uint32 _backlogTime = 0;
+    uint32 _idleTime = 0;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
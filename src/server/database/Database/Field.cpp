@@ -223,16 +223,16 @@ T Field::GetData() const
             result = Acore::StringTo<float>(std::string_view(data.value, data.length));
     }
 
-    // Check -1 for *_dbc db tables
+    // Check -1 for *_dbc db tables, only values that failed to convert need the second parse
     if constexpr (std::is_same_v<T, uint32>)
     {
         std::string_view tableName{ meta->TableName };
 
-        if (!tableName.empty() && tableName.size() > 4)
+        if (!result && tableName.size() > 4 && tableName.substr(tableName.length() - 4) == "_dbc")
         {
             auto signedResult = Acore::StringTo<int32>(std::string_view(data.value, data.length));
 
-            if (signedResult && !result && tableName.substr(tableName.length() - 4) == "_dbc")
+            if (signedResult)
             {
                 LOG_DEBUG("sql.sql", "> Found incorrect value '{}' for type '{}' in _dbc table.", data.value, typeid(T).name());
                 LOG_DEBUG("sql.sql", "> Table name '{}'. Field name '{}'. Try return int32 value", meta->TableName, meta->Name);
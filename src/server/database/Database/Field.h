@@ -98,6 +98,8 @@ class AC_DATABASE_API Field
 {
 friend class ResultSet;
 friend class PreparedResultSet;
+friend class QuerySnapshot;
+friend class ResultValue;
 
 public:
     Field();
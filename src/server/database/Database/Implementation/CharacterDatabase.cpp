@@ -17,6 +17,7 @@
 
 #include "CharacterDatabase.h"
 #include "MySQLPreparedStatement.h"
+#include "PreparedResultCache.h"
 
 void CharacterDatabaseConnection::DoPrepareStatements()
 {
@@ -238,6 +239,9 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     // Auras
     PrepareStatement(CHAR_INS_AURA, "INSERT INTO character_aura (guid, casterGuid, itemGuid, spell, effectMask, recalculateMask, stackcount, amount0, amount1, amount2, base_amount0, base_amount1, base_amount2, maxDuration, remainTime, remainCharges) "
                      "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_REP_AURA, "REPLACE INTO character_aura (guid, casterGuid, itemGuid, spell, effectMask, recalculateMask, stackcount, amount0, amount1, amount2, base_amount0, base_amount1, base_amount2, maxDuration, remainTime, remainCharges) "
+                     "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_DEL_CHAR_AURA_BY_KEY, "DELETE FROM character_aura WHERE guid = ? AND casterGuid = ? AND itemGuid = ? AND spell = ? AND effectMask = ?", CONNECTION_ASYNC);
 
     // Account data
     PrepareStatement(CHAR_SEL_ACCOUNT_DATA, "SELECT type, time, data FROM account_data WHERE accountId = ?", CONNECTION_ASYNC);
@@ -622,6 +626,52 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PrepareStatement(CHAR_REP_WORLD_STATE, "REPLACE INTO world_state (Id, Data) VALUES(?, ?)", CONNECTION_ASYNC);
 }
 
+void CharacterDatabaseConnection::DoPrepareResultCache(PreparedResultCache& cache)
+{
+    // Read at every login and hardly ever written while playing
+    cache.AddStatement(CHAR_SEL_ACCOUNT_DATA);
+    cache.AddInvalidation(CHAR_REP_ACCOUNT_DATA, CHAR_SEL_ACCOUNT_DATA, 0);
+    cache.AddInvalidation(CHAR_DEL_ACCOUNT_DATA, CHAR_SEL_ACCOUNT_DATA, 0);
+
+    cache.AddStatement(CHAR_SEL_PLAYER_ACCOUNT_DATA);
+    cache.AddInvalidation(CHAR_REP_PLAYER_ACCOUNT_DATA, CHAR_SEL_PLAYER_ACCOUNT_DATA, 0);
+    cache.AddInvalidation(CHAR_DEL_PLAYER_ACCOUNT_DATA, CHAR_SEL_PLAYER_ACCOUNT_DATA, 0);
+
+    cache.AddStatement(CHAR_SEL_TUTORIALS);
+    cache.AddInvalidation(CHAR_INS_TUTORIALS, CHAR_SEL_TUTORIALS, 8);
+    cache.AddInvalidation(CHAR_UPD_TUTORIALS, CHAR_SEL_TUTORIALS, 8);
+    cache.AddInvalidation(CHAR_DEL_TUTORIALS, CHAR_SEL_TUTORIALS, 0);
+
+    // The social list skips deleted friends, deleting or restoring any character changes it
+    cache.AddStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
+    cache.AddInvalidation(CHAR_INS_CHARACTER_SOCIAL, CHAR_SEL_CHARACTER_SOCIALLIST, 0);
+    cache.AddInvalidation(CHAR_DEL_CHARACTER_SOCIAL, CHAR_SEL_CHARACTER_SOCIALLIST, 0);
+    cache.AddInvalidation(CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS, CHAR_SEL_CHARACTER_SOCIALLIST, 1);
+    cache.AddInvalidation(CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS, CHAR_SEL_CHARACTER_SOCIALLIST, 1);
+    cache.AddInvalidation(CHAR_UPD_CHARACTER_SOCIAL_NOTE, CHAR_SEL_CHARACTER_SOCIALLIST, 1);
+    cache.AddInvalidation(CHAR_DEL_CHAR_SOCIAL_BY_GUID, CHAR_SEL_CHARACTER_SOCIALLIST, 0);
+    cache.AddInvalidation(CHAR_DEL_CHAR_SOCIAL_BY_FRIEND, CHAR_SEL_CHARACTER_SOCIALLIST);
+    cache.AddInvalidation(CHAR_UPD_DELETE_INFO, CHAR_SEL_CHARACTER_SOCIALLIST);
+    cache.AddInvalidation(CHAR_UDP_RESTORE_DELETE_INFO, CHAR_SEL_CHARACTER_SOCIALLIST);
+    cache.AddInvalidation(CHAR_DEL_CHARACTER, CHAR_SEL_CHARACTER_SOCIALLIST);
+
+    for (uint32 read : { CHAR_SEL_CHARACTER_HOMEBIND, CHAR_SEL_CHAR_HOMEBIND })
+    {
+        cache.AddStatement(read);
+        cache.AddInvalidation(CHAR_INS_PLAYER_HOMEBIND, read, 0);
+        cache.AddInvalidation(CHAR_UPD_PLAYER_HOMEBIND, read, 5);
+        cache.AddInvalidation(CHAR_DEL_PLAYER_HOMEBIND, read, 0);
+    }
+
+    cache.AddStatement(CHAR_SEL_CHARACTER_GLYPHS);
+    cache.AddInvalidation(CHAR_INS_CHAR_GLYPHS, CHAR_SEL_CHARACTER_GLYPHS, 0);
+    cache.AddInvalidation(CHAR_DEL_CHAR_GLYPHS, CHAR_SEL_CHARACTER_GLYPHS, 0);
+
+    cache.AddStatement(CHAR_SEL_CHAR_SETTINGS);
+    cache.AddInvalidation(CHAR_REP_CHAR_SETTINGS, CHAR_SEL_CHAR_SETTINGS, 0);
+    cache.AddInvalidation(CHAR_DEL_CHAR_SETTINGS, CHAR_SEL_CHAR_SETTINGS, 0);
+}
+
 CharacterDatabaseConnection::CharacterDatabaseConnection(MySQLConnectionInfo& connInfo) : MySQLConnection(connInfo)
 {
 }
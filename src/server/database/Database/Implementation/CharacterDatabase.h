@@ -194,6 +194,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_EQUIP_SET,
 
     CHAR_INS_AURA,
+    CHAR_REP_AURA,
+    CHAR_DEL_CHAR_AURA_BY_KEY,
 
     CHAR_SEL_ACCOUNT_DATA,
     CHAR_REP_ACCOUNT_DATA,
@@ -546,6 +548,9 @@ public:
 
     //- Loads database type specific prepared statements
     void DoPrepareStatements() override;
+
+    //- Registers the statements read at login for the result cache
+    void DoPrepareResultCache(PreparedResultCache& cache) override;
 };
 
 #endif
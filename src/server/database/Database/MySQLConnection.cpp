@@ -49,6 +49,7 @@ MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 
 MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
+    m_reconnects(0),
     m_prepareError(false),
     m_Mysql(nullptr),
     m_queue(nullptr),
@@ -57,14 +58,12 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
 
 MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
+    m_reconnects(0),
     m_prepareError(false),
     m_Mysql(nullptr),
     m_queue(queue),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_ASYNC)
-{
-    m_worker = std::make_unique<DatabaseWorker>(m_queue, this);
-}
+    m_connectionFlags(CONNECTION_ASYNC) { }
 
 MySQLConnection::~MySQLConnection()
 {
@@ -166,6 +165,12 @@ uint32 MySQLConnection::Open()
     }
 }
 
+void MySQLConnection::StartWorker()
+{
+    if (m_queue && !m_worker)
+        m_worker = std::make_unique<DatabaseWorker>(m_queue, this, m_connectionInfo);
+}
+
 bool MySQLConnection::PrepareStatements()
 {
     DoPrepareStatements();
@@ -593,6 +598,7 @@ bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 att
                         (m_connectionFlags & CONNECTION_ASYNC) ? "asynchronous" : "synchronous");
 
                 m_reconnecting = false;
+                ++m_reconnects;
                 return true;
             }
 
@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include <map>
 #include <mutex>
 #include <string>
@@ -30,6 +31,7 @@ class ProducerConsumerQueue;
 
 class DatabaseWorker;
 class MySQLPreparedStatement;
+class PreparedResultCache;
 class SQLOperation;
 
 enum ConnectionFlags
@@ -49,6 +51,11 @@ struct AC_DATABASE_API MySQLConnectionInfo
     std::string host;
     std::string port_or_socket;
     std::string ssl;
+
+    // Async workers run up to batchSize consecutive one-way statements in one transaction,
+    // waiting at most batchDelay for more of them to be queued
+    uint32 batchSize = 1;
+    Milliseconds batchDelay = 0ms;
 };
 
 class AC_DATABASE_API MySQLConnection
@@ -75,6 +82,9 @@ public:
     bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
     bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
+    //! Starts the worker thread of an async connection, after the connection was opened
+    void StartWorker();
+
     void BeginTransaction();
     void RollbackTransaction();
     void CommitTransaction();
@@ -84,6 +94,9 @@ public:
 
     uint32 GetLastError();
 
+    //! Number of times the connection was reestablished, an open transaction is lost each time
+    [[nodiscard]] uint32 GetReconnectCount() const { return m_reconnects; }
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
@@ -98,12 +111,15 @@ protected:
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
 
     virtual void DoPrepareStatements() = 0;
+    //! Registers the statements whose results may be cached and the writes invalidating them
+    virtual void DoPrepareResultCache(PreparedResultCache& /*cache*/) { }
     virtual bool _HandleMySQLErrno(uint32 errNo, char const* err = "", uint8 attempts = 5);
 
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
     bool m_reconnecting;  //! Are we reconnecting?
+    uint32 m_reconnects;  //! Successful reconnects so far
     bool m_prepareError;  //! Was there any error while preparing statements?
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
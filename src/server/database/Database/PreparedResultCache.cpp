@@ -0,0 +1,283 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PreparedResultCache.h"
+#include "Errors.h"
+#include "QueryResult.h"
+#include "StringFormat.h"
+#include "Transaction.h"
+#include <algorithm>
+
+class PreparedResultCache::Write
+{
+public:
+    explicit Write(PreparedResultCache& cache) : _cache(cache) { }
+    ~Write()
+    {
+        if (Started)
+            _cache.Invalidate(*this, false);
+    }
+
+    [[nodiscard]] bool IsEmpty() const { return Keys.empty() && AllKeys.empty(); }
+
+    std::vector<std::pair<uint32, std::string>> Keys;
+    std::vector<uint32> AllKeys;
+    bool Started = false;
+
+private:
+    PreparedResultCache& _cache;
+};
+
+PreparedResultCache::PreparedResultCache(std::size_t maxEntries, Seconds lifetime) :
+    _maxEntries(maxEntries), _lifetime(lifetime) { }
+
+PreparedResultCache::~PreparedResultCache() = default;
+
+void PreparedResultCache::AddStatement(uint32 read)
+{
+    if (_cached.size() <= read)
+    {
+        _cached.resize(read + 1);
+        _pendingAllKeys.resize(read + 1);
+    }
+
+    _cached[read] = true;
+}
+
+void PreparedResultCache::AddInvalidation(uint32 write, uint32 read, uint8 keyParam /*= AllKeys*/)
+{
+    ASSERT(IsCached(read), "Invalidation added for statement {} which is not cached", read);
+
+    if (_invalidations.size() <= write)
+        _invalidations.resize(write + 1);
+
+    _invalidations[write].push_back({ read, keyParam });
+}
+
+std::string PreparedResultCache::MakeKey(uint32 statement, PreparedStatementData const& param)
+{
+    return std::visit([statement](auto const& value)
+    {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, std::vector<uint8>>)
+            return Acore::StringFormat("{}:", statement).append(value.begin(), value.end());
+        else if constexpr (std::is_same_v<T, std::nullptr_t>)
+            return Acore::StringFormat("{}:NULL", statement);
+        else
+            return Acore::StringFormat("{}:{}", statement, value);
+    }, param.data);
+}
+
+std::string PreparedResultCache::MakeKey(PreparedStatementBase const* stmt)
+{
+    ASSERT(stmt->GetParameters().size() == 1, "Cached statement {} must take exactly one parameter", stmt->GetIndex());
+    return MakeKey(stmt->GetIndex(), stmt->GetParameters().front());
+}
+
+bool PreparedResultCache::Find(uint32 statement, std::string const& key, PreparedQueryResult& result, uint32& generation)
+{
+    std::shared_ptr<PreparedResultSet const> cached;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto itr = _index.find(key);
+        if (itr == _index.end() || itr->second->Expires <= std::chrono::steady_clock::now())
+        {
+            if (itr != _index.end())
+            {
+                _entries.erase(itr->second);
+                _index.erase(itr);
+            }
+
+            ++_stats.Misses;
+
+            Pending& pending = _pending[key];
+            pending.Statement = statement;
+            ++pending.Readers;
+            generation = pending.Generation;
+            return false;
+        }
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        cached = itr->second->Result;
+        ++_stats.Hits;
+    }
+
+    // Every caller iterates its own result, the rows are shared
+    if (cached)
+        result = std::make_shared<PreparedResultSet>(std::move(cached));
+
+    return true;
+}
+
+PreparedQueryResult PreparedResultCache::Store(uint32 statement, std::string const& key, uint32 generation, PreparedResultSet* result)
+{
+    std::shared_ptr<PreparedResultSet const> cached;
+    if (result && result->GetRowCount())
+        cached.reset(result);
+    else
+        delete result;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto pendingItr = _pending.find(key);
+    ASSERT(pendingItr != _pending.end());
+
+    Pending& pending = pendingItr->second;
+
+    // A write to the key was queued or executed while reading, what was read may already be outdated
+    bool const keep = pending.Generation == generation && !pending.Writers && !_pendingAllKeys[statement];
+    if (!--pending.Readers && !pending.Writers)
+        _pending.erase(pendingItr);
+
+    if (keep && _maxEntries && !_index.contains(key))
+    {
+        _entries.push_front({ key, statement, cached, std::chrono::steady_clock::now() + _lifetime });
+        _index.emplace(key, _entries.begin());
+
+        if (_entries.size() > _maxEntries)
+        {
+            _index.erase(_entries.back().Key);
+            _entries.pop_back();
+        }
+    }
+
+    if (!cached)
+        return PreparedQueryResult(nullptr);
+
+    return std::make_shared<PreparedResultSet>(std::move(cached));
+}
+
+void PreparedResultCache::AddWrite(Write& write, PreparedStatementBase const* stmt) const
+{
+    uint32 const index = stmt->GetIndex();
+    if (index >= _invalidations.size())
+        return;
+
+    for (Invalidation const& invalidation : _invalidations[index])
+    {
+        if (invalidation.KeyParam == AllKeys)
+            write.AllKeys.push_back(invalidation.Read);
+        else
+            write.Keys.emplace_back(invalidation.Read, MakeKey(invalidation.Read, stmt->GetParameters().at(invalidation.KeyParam)));
+    }
+}
+
+std::shared_ptr<void> PreparedResultCache::BeginWrite(PreparedStatementBase const* stmt)
+{
+    auto write = std::make_unique<Write>(*this);
+    AddWrite(*write, stmt);
+    return BeginWrite(std::move(write));
+}
+
+std::shared_ptr<void> PreparedResultCache::BeginWrite(TransactionBase const& transaction)
+{
+    auto write = std::make_unique<Write>(*this);
+    for (SQLElementData const& element : transaction.m_queries)
+    {
+        // Ad hoc statements can change anything
+        if (element.type == SQL_ELEMENT_RAW)
+            return BeginAdhocWrite();
+
+        AddWrite(*write, std::get<PreparedStatementBase*>(element.element));
+    }
+
+    return BeginWrite(std::move(write));
+}
+
+std::shared_ptr<void> PreparedResultCache::BeginAdhocWrite()
+{
+    auto write = std::make_unique<Write>(*this);
+    for (uint32 statement = 0; statement < _cached.size(); ++statement)
+        if (_cached[statement])
+            write->AllKeys.push_back(statement);
+
+    return BeginWrite(std::move(write));
+}
+
+std::shared_ptr<void> PreparedResultCache::BeginWrite(std::unique_ptr<Write> write)
+{
+    if (write->IsEmpty())
+        return nullptr;
+
+    Invalidate(*write, true);
+    write->Started = true;
+    return std::shared_ptr<Write>(std::move(write));
+}
+
+void PreparedResultCache::Invalidate(Write const& write, bool begin)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    for (auto const& [statement, key] : write.Keys)
+    {
+        EraseEntry(key);
+
+        Pending& pending = _pending[key];
+        pending.Statement = statement;
+        ++pending.Generation;
+
+        if (begin)
+            ++pending.Writers;
+        else if (!--pending.Writers && !pending.Readers)
+            _pending.erase(key);
+    }
+
+    for (uint32 statement : write.AllKeys)
+    {
+        if (begin)
+            ++_pendingAllKeys[statement];
+        else
+            --_pendingAllKeys[statement];
+
+        for (auto itr = _entries.begin(); itr != _entries.end();)
+        {
+            if (itr->Statement == statement)
+            {
+                _index.erase(itr->Key);
+                itr = _entries.erase(itr);
+            }
+            else
+                ++itr;
+        }
+
+        for (auto& [key, pending] : _pending)
+            if (pending.Statement == statement)
+                ++pending.Generation;
+    }
+}
+
+void PreparedResultCache::EraseEntry(std::string const& key)
+{
+    auto itr = _index.find(key);
+    if (itr == _index.end())
+        return;
+
+    _entries.erase(itr->second);
+    _index.erase(itr);
+}
+
+PreparedResultCacheStats PreparedResultCache::Collect()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    PreparedResultCacheStats stats = _stats;
+    stats.Entries = _entries.size();
+    _stats = {};
+    return stats;
+}
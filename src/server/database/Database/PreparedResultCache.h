@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PREPAREDRESULTCACHE_H
+#define _PREPAREDRESULTCACHE_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Duration.h"
+#include "PreparedStatement.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TransactionBase;
+
+struct PreparedResultCacheStats
+{
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    std::size_t Entries = 0;
+};
+
+/**
+    @class PreparedResultCache
+    @brief Keeps the results of selected read-only prepared statements in memory.
+
+    Cached statements take exactly one parameter, results are keyed by the statement and its value.
+    Every write statement that changes what a cached statement reads has to be registered with
+    AddInvalidation, either with the parameter holding the same key or for all keys. Ad hoc writes
+    drop everything.
+
+    A write drops the results it changes when it is queued and again once it was executed, results
+    read while it is in flight are returned but not kept, so a result never outlives a write to it.
+*/
+class AC_DATABASE_API PreparedResultCache
+{
+public:
+    static constexpr uint8 AllKeys = 0xFF;
+
+    PreparedResultCache(std::size_t maxEntries, Seconds lifetime);
+    ~PreparedResultCache();
+
+    PreparedResultCache(PreparedResultCache const&) = delete;
+    PreparedResultCache& operator=(PreparedResultCache const&) = delete;
+
+    //! Caches the results of statement read
+    void AddStatement(uint32 read);
+
+    //! Executing write changes the rows read keyed by its parameter keyParam, or by any key for AllKeys
+    void AddInvalidation(uint32 write, uint32 read, uint8 keyParam = AllKeys);
+
+    [[nodiscard]] bool IsCached(uint32 index) const { return index < _cached.size() && _cached[index]; }
+
+    //! Returns the cached result of stmt, or the one returned by fetch() which is cached then.
+    //! fetch returns a PreparedResultSet* owned by the caller, as MySQLConnection::Query does.
+    template<typename Fetch>
+    PreparedQueryResult Query(PreparedStatementBase const* stmt, Fetch&& fetch)
+    {
+        std::string key = MakeKey(stmt);
+
+        PreparedQueryResult result;
+        uint32 generation;
+        if (Find(stmt->GetIndex(), key, result, generation))
+            return result;
+
+        return Store(stmt->GetIndex(), key, generation, fetch());
+    }
+
+    //! Drops the results the write changes. The returned handle has to be kept until the write was executed,
+    //! releasing it drops them again. Empty if nothing cached is affected.
+    std::shared_ptr<void> BeginWrite(PreparedStatementBase const* stmt);
+    std::shared_ptr<void> BeginWrite(TransactionBase const& transaction);
+    std::shared_ptr<void> BeginAdhocWrite();
+
+    //! Returns the statistics since the last call
+    PreparedResultCacheStats Collect();
+
+private:
+    struct Invalidation
+    {
+        uint32 Read;
+        uint8 KeyParam;
+    };
+
+    struct Entry
+    {
+        std::string Key;
+        uint32 Statement;
+        std::shared_ptr<PreparedResultSet const> Result;    // nullptr for a query without rows
+        TimePoint Expires;
+    };
+
+    // Keys with reads or writes in flight
+    struct Pending
+    {
+        uint32 Statement = 0;
+        uint32 Readers = 0;
+        uint32 Writers = 0;
+        uint32 Generation = 0;      // changes with every write to the key
+    };
+
+    class Write;
+
+    static std::string MakeKey(uint32 statement, PreparedStatementData const& param);
+    static std::string MakeKey(PreparedStatementBase const* stmt);
+
+    bool Find(uint32 statement, std::string const& key, PreparedQueryResult& result, uint32& generation);
+    PreparedQueryResult Store(uint32 statement, std::string const& key, uint32 generation, PreparedResultSet* result);
+
+    void AddWrite(Write& write, PreparedStatementBase const* stmt) const;
+    std::shared_ptr<void> BeginWrite(std::unique_ptr<Write> write);
+    void Invalidate(Write const& write, bool begin);
+    void EraseEntry(std::string const& key);
+
+    std::size_t const _maxEntries;
+    Seconds const _lifetime;
+
+    // Set up before the cache is used, read only afterwards
+    std::vector<bool> _cached;
+    std::vector<std::vector<Invalidation>> _invalidations;
+
+    std::mutex _lock;
+    std::list<Entry> _entries;      // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> _index;
+    std::unordered_map<std::string, Pending> _pending;
+    std::vector<uint32> _pendingAllKeys;    // writes in flight changing every key, per statement
+    PreparedResultCacheStats _stats;
+};
+
+#endif
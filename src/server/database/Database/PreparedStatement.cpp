@@ -19,6 +19,7 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MySQLConnection.h"
+#include "PreparedResultCache.h"
 #include "MySQLWorkaround.h"
 #include "QueryResult.h"
 
@@ -49,6 +50,12 @@ void PreparedStatementBase::SetValidData(const uint8 index, std::string_view val
     statement_data[index].data.emplace<std::string>(value);
 }
 
+void PreparedStatementBase::SetData(const uint8 index, PreparedStatementData const& value)
+{
+    ASSERT(index < statement_data.size());
+    statement_data[index] = value;
+}
+
 template void PreparedStatementBase::SetValidData(const uint8 index, uint8 const& value);
 template void PreparedStatementBase::SetValidData(const uint8 index, int8 const& value);
 template void PreparedStatementBase::SetValidData(const uint8 index, uint16 const& value);
@@ -85,6 +92,13 @@ bool PreparedStatementTask::Execute()
 {
     if (m_has_result)
     {
+        if (m_resultCache && m_resultCache->IsCached(m_stmt->GetIndex()))
+        {
+            PreparedQueryResult result = m_resultCache->Query(m_stmt, [this]() { return m_conn->Query(m_stmt); });
+            m_result->set_value(result);
+            return result != nullptr;
+        }
+
         PreparedResultSet* result = m_conn->Query(m_stmt);
         if (!result || !result->GetRowCount())
         {
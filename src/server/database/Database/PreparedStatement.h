@@ -113,6 +113,9 @@ public:
         SetValidData(index, convertToUin32 ? static_cast<uint32>(value.count()) : value.count());
     }
 
+    // Set a parameter taken from another statement
+    void SetData(const uint8 index, PreparedStatementData const& value);
+
     // Set all
     template <typename... Args>
     inline void SetArguments(Args&&... args)
@@ -173,6 +176,8 @@ public:
     ~PreparedStatementTask() override;
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override { return !m_has_result; }
+    [[nodiscard]] uint32 GetStatementId() const override { return m_stmt->GetIndex(); }
     PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
 
 protected:
@@ -19,6 +19,7 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MySQLConnection.h"
+#include "PreparedResultCache.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
 
@@ -78,8 +79,16 @@ bool SQLQueryHolderTask::Execute()
 {
     /// execute all queries in the holder and pass the results
     for (std::size_t i = 0; i < m_holder->m_queries.size(); ++i)
-        if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
+    {
+        PreparedStatementBase* stmt = m_holder->m_queries[i].first;
+        if (!stmt)
+            continue;
+
+        if (m_resultCache && m_resultCache->IsCached(stmt->GetIndex()))
+            m_holder->m_queries[i].second = m_resultCache->Query(stmt, [this, stmt]() { return m_conn->Query(stmt); });
+        else
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
+    }
 
     m_result.set_value();
     return true;
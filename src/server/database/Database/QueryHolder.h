@@ -58,6 +58,7 @@ public:
     ~SQLQueryHolderTask();
 
     bool Execute() override;
+    [[nodiscard]] uint32 GetStatementId() const override { return SQL_STATEMENT_ID_QUERY_HOLDER; }
     QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
 
 private:
@@ -21,6 +21,9 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include "StringConvert.h"
+#include <cstring>
+#include <limits>
 
 namespace
 {
@@ -168,7 +171,9 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _storedRow(nullptr),
+    _storedRowsLeft(0)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -180,6 +185,21 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, uint64 rowCount, std::shared_ptr<void const> storage) :
+    _fieldMetadata(std::move(fieldMetadata)),
+    _rowCount(rowCount),
+    _fieldCount(uint32(_fieldMetadata.size())),
+    _result(nullptr),
+    _fields(nullptr),
+    _storage(std::move(storage)),
+    _storedRow(rows),
+    _storedRowsLeft(rowCount)
+{
+    _currentRow = new Field[_fieldCount];
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -187,6 +207,9 @@ ResultSet::~ResultSet()
 
 bool ResultSet::NextRow()
 {
+    if (_storage)
+        return NextStoredRow();
+
     MYSQL_ROW row;
 
     if (!_result)
@@ -213,10 +236,38 @@ bool ResultSet::NextRow()
     return true;
 }
 
+bool ResultSet::NextStoredRow()
+{
+    if (!_storedRowsLeft)
+    {
+        CleanUp();
+        return false;
+    }
+
+    // Every value is its length followed by the bytes and a terminating zero, NULL has no bytes
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        uint32 length;
+        memcpy(&length, _storedRow, sizeof(length));
+        _storedRow += sizeof(length);
+
+        if (length == std::numeric_limits<uint32>::max())
+            _currentRow[i].SetStructuredValue(nullptr, 0);
+        else
+        {
+            _currentRow[i].SetStructuredValue(_storedRow, length);
+            _storedRow += length + 1;
+        }
+    }
+
+    --_storedRowsLeft;
+    return true;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
 }
 
 void ResultSet::CleanUp()
@@ -232,6 +283,8 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _storage.reset();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -245,6 +298,36 @@ void ResultSet::AssertRows(std::size_t sizeRows)
     ASSERT(sizeRows == _fieldCount);
 }
 
+template<typename T>
+T ResultValue::GetNumber() const
+{
+#ifndef ACORE_STRICT_DATABASE_TYPE_CHECKS
+    if (_field.data.value && !_field.data.raw)
+        if (Optional<T> value = Acore::StringTo<T>(std::string_view(_field.data.value, _field.data.length)))
+            return *value;
+#endif
+
+    return _field.Get<T>();
+}
+
+template bool ResultValue::GetNumber() const;
+template uint8 ResultValue::GetNumber() const;
+template uint16 ResultValue::GetNumber() const;
+template uint32 ResultValue::GetNumber() const;
+template uint64 ResultValue::GetNumber() const;
+template int8 ResultValue::GetNumber() const;
+template int16 ResultValue::GetNumber() const;
+template int32 ResultValue::GetNumber() const;
+template int64 ResultValue::GetNumber() const;
+template float ResultValue::GetNumber() const;
+template double ResultValue::GetNumber() const;
+
+ResultValue ResultRow::operator[](std::size_t index) const
+{
+    ASSERT(index < _fieldCount);
+    return ResultValue(_fields[index]);
+}
+
 PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
     m_rowCount(rowCount),
     m_rowPosition(0),
@@ -377,6 +460,18 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     mysql_stmt_free_result(m_stmt);
 }
 
+PreparedResultSet::PreparedResultSet(std::shared_ptr<PreparedResultSet const> source) :
+    m_rows(source->m_rows),
+    m_rowCount(source->m_rowCount),
+    m_rowPosition(0),
+    m_fieldCount(source->m_fieldCount),
+    m_rBind(nullptr),
+    m_stmt(nullptr),
+    m_metadataResult(nullptr),
+    m_source(std::move(source))
+{
+}
+
 PreparedResultSet::~PreparedResultSet()
 {
     CleanUp();
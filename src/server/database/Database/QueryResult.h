@@ -21,6 +21,9 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -45,10 +48,69 @@ private:
     pointer _ptr;
 };
 
+/**
+    @class ResultValue
+
+    @brief Value of one column in the current row of a ResultRow.
+
+    Parses the value straight from the row buffer. Values the plain conversion can not
+    handle (NULL, binary values, aggregates read as another type, -1 in *_dbc tables)
+    fall back to Field::Get and behave exactly like it.
+*/
+class AC_DATABASE_API ResultValue
+{
+public:
+    explicit ResultValue(Field const& field) : _field(field) { }
+
+    [[nodiscard]] bool IsNull() const { return _field.IsNull(); }
+
+    template<typename T>
+    inline T Get() const
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+            return GetNumber<T>();
+        else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+            return IsNull() ? T() : T(_field.data.value, _field.data.length);
+        else
+            return _field.Get<T>();
+    }
+
+private:
+    template<typename T>
+    T GetNumber() const;
+
+    Field const& _field;
+};
+
+/**
+    @class ResultRow
+
+    @brief Current row of a ResultSet for loops over large tables.
+
+    Used like the Field array returned by ResultSet::Fetch, but Get skips the per-value
+    checks of Field::Get that cost more than the conversion itself when a table has
+    millions of values. Nothing is copied, values point into the MySQL row buffer.
+*/
+class AC_DATABASE_API ResultRow
+{
+public:
+    ResultRow(Field const* fields, uint32 fieldCount) : _fields(fields), _fieldCount(fieldCount) { }
+
+    ResultValue operator[](std::size_t index) const;
+
+private:
+    Field const* _fields;
+    uint32 _fieldCount;
+};
+
 class AC_DATABASE_API ResultSet
 {
+friend class QuerySnapshot;
+
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    //! Reads rows stored by QuerySnapshot, storage keeps the memory they point to alive
+    ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, uint64 rowCount, std::shared_ptr<void const> storage);
     ~ResultSet();
 
     bool NextRow();
@@ -57,6 +119,7 @@ public:
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
 
     [[nodiscard]] Field* Fetch() const { return _currentRow; }
+    [[nodiscard]] ResultRow FetchRow() const { return { _currentRow, _fieldCount }; }
     Field const& operator[](std::size_t index) const;
 
     template<typename... Ts>
@@ -87,10 +150,15 @@ protected:
 private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
+    bool NextStoredRow();
 
     MySQLResult* _result;
     MySQLField* _fields;
 
+    std::shared_ptr<void const> _storage;
+    char const* _storedRow;
+    uint64 _storedRowsLeft;
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
@@ -99,6 +167,8 @@ class AC_DATABASE_API PreparedResultSet
 {
 public:
     PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+    //! Reads the rows of another result, sharing its buffers. Used for results kept by PreparedResultCache.
+    explicit PreparedResultSet(std::shared_ptr<PreparedResultSet const> source);
     ~PreparedResultSet();
 
     bool NextRow();
@@ -138,6 +208,7 @@ private:
     MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
+    std::shared_ptr<PreparedResultSet const> m_source;    ///< Result owning the buffers the rows point into
 
     void CleanUp();
     bool _NextRow();
@@ -0,0 +1,303 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QuerySnapshot.h"
+#include "Log.h"
+#include "MappedFile.h"
+#include "QueryResult.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+
+/*
+    File layout, all numbers in host byte order:
+
+    header: "ACQS", uint32 version, string state, uint32 entry count
+    entry:  string sql, uint32 field count,
+            per field: string table, string table alias, string name, string alias, string type name, uint8 type
+            uint64 row count, uint64 row bytes,
+            per row and field: uint32 length (uint32 max for NULL), length bytes, terminating zero
+    string: uint32 length, bytes
+*/
+
+namespace
+{
+    constexpr char SnapshotMagic[4] = { 'A', 'C', 'Q', 'S' };
+    constexpr uint32 SnapshotVersion = 1;
+    constexpr uint32 NullLength = std::numeric_limits<uint32>::max();
+
+    template<typename T>
+    bool Read(char const*& pos, char const* end, T& value)
+    {
+        if (std::size_t(end - pos) < sizeof(T))
+            return false;
+
+        memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(char const*& pos, char const* end, std::string_view& value)
+    {
+        uint32 length;
+        if (!Read(pos, end, length) || std::size_t(end - pos) < length)
+            return false;
+
+        value = std::string_view(pos, length);
+        pos += length;
+        return true;
+    }
+
+    template<typename T>
+    void Append(std::string& out, T value)
+    {
+        out.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    void AppendString(std::string& out, std::string_view value)
+    {
+        Append(out, uint32(value.size()));
+        out.append(value);
+    }
+}
+
+QuerySnapshot::QuerySnapshot(std::string path, std::string state) : _path(std::move(path)), _state(std::move(state))
+{
+    Load();
+}
+
+QuerySnapshot::~QuerySnapshot() = default;
+
+void QuerySnapshot::Load()
+{
+    std::shared_ptr<Acore::MappedFile> file = Acore::MappedFile::Open(_path);
+    if (!file)
+    {
+        LOG_INFO("sql.driver", "Query snapshot {} not found, it will be written after loading.", _path);
+        return;
+    }
+
+    char const* pos = reinterpret_cast<char const*>(file->GetData());
+    char const* const end = pos + file->GetSize();
+
+    char magic[4];
+    uint32 version, entryCount;
+    std::string_view state;
+    if (!Read(pos, end, magic) || memcmp(magic, SnapshotMagic, sizeof(magic)) || !Read(pos, end, version) || version != SnapshotVersion
+        || !ReadString(pos, end, state) || state != _state || !Read(pos, end, entryCount))
+    {
+        LOG_INFO("sql.driver", "Query snapshot {} was written for another database state or version, it will be rebuilt.", _path);
+        return;
+    }
+
+    for (uint32 i = 0; i < entryCount; ++i)
+    {
+        Entry entry;
+        entry.Storage = file;
+        entry.Data = pos;
+        if (!ParseEntry(pos, end, entry))
+        {
+            LOG_ERROR("sql.driver", "Query snapshot {} is damaged, it will be rebuilt.", _path);
+            _entries.clear();
+            return;
+        }
+
+        entry.Size = pos - entry.Data;
+        std::string_view sql = entry.Sql;
+        _entries.emplace(sql, std::move(entry));
+    }
+
+    _loadedCount = _entries.size();
+    LOG_INFO("sql.driver", "Loaded {} query result(s) from snapshot {}.", _loadedCount, _path);
+}
+
+bool QuerySnapshot::ParseEntry(char const*& pos, char const* end, Entry& entry)
+{
+    uint32 fieldCount;
+    if (!ReadString(pos, end, entry.Sql) || !Read(pos, end, fieldCount))
+        return false;
+
+    entry.Metadata.resize(fieldCount);
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        std::string_view tableName, tableAlias, name, alias, typeName;
+        uint8 type;
+        if (!ReadString(pos, end, tableName) || !ReadString(pos, end, tableAlias) || !ReadString(pos, end, name)
+            || !ReadString(pos, end, alias) || !ReadString(pos, end, typeName) || !Read(pos, end, type))
+            return false;
+
+        QueryResultFieldMetadata& meta = entry.Metadata[i];
+        meta.TableName = tableName;
+        meta.TableAlias = tableAlias;
+        meta.Name = name;
+        meta.Alias = alias;
+        meta.TypeName = typeName;
+        meta.Index = i;
+        meta.Type = DatabaseFieldTypes(type);
+    }
+
+    uint64 rowBytes;
+    if (!Read(pos, end, entry.RowCount) || !Read(pos, end, rowBytes) || uint64(end - pos) < rowBytes)
+        return false;
+
+    entry.Rows = pos;
+    pos += rowBytes;
+
+    // Walk the values once so reading the rows later can not run past the entry
+    char const* row = entry.Rows;
+    for (uint64 i = 0; i < entry.RowCount * fieldCount; ++i)
+    {
+        uint32 length;
+        if (!Read(row, pos, length))
+            return false;
+
+        if (length != NullLength)
+        {
+            if (std::size_t(pos - row) <= length || row[length] != '\0')
+                return false;
+
+            row += length + 1;
+        }
+    }
+
+    return row == pos;
+}
+
+ResultSet* QuerySnapshot::Find(std::string_view sql) const
+{
+    std::shared_lock<std::shared_mutex> guard(_lock);
+
+    auto itr = _entries.find(sql);
+    if (itr == _entries.end())
+        return nullptr;
+
+    Entry const& entry = itr->second;
+    return new ResultSet(entry.Metadata, entry.Rows, entry.RowCount, entry.Storage);
+}
+
+ResultSet* QuerySnapshot::Store(std::string_view sql, ResultSet* result)
+{
+    std::shared_ptr<std::string> data = std::make_shared<std::string>();
+
+    AppendString(*data, sql);
+    Append(*data, result->GetFieldCount());
+    for (QueryResultFieldMetadata const& meta : result->_fieldMetadata)
+    {
+        AppendString(*data, meta.TableName);
+        AppendString(*data, meta.TableAlias);
+        AppendString(*data, meta.Name);
+        AppendString(*data, meta.Alias);
+        AppendString(*data, meta.TypeName);
+        Append(*data, uint8(meta.Type));
+    }
+
+    std::size_t const countOffset = data->size();
+    Append(*data, uint64(0));
+    Append(*data, uint64(0));
+
+    uint32 const fieldCount = result->GetFieldCount();
+    uint64 rowCount = 0;
+    while (result->NextRow())
+    {
+        Field const* fields = result->Fetch();
+        for (uint32 i = 0; i < fieldCount; ++i)
+        {
+            if (fields[i].IsNull())
+            {
+                Append(*data, NullLength);
+                continue;
+            }
+
+            Append(*data, fields[i].data.length);
+            data->append(fields[i].data.value, fields[i].data.length);
+            data->push_back('\0');
+        }
+
+        ++rowCount;
+    }
+
+    delete result;
+
+    uint64 const rowBytes = data->size() - countOffset - 2 * sizeof(uint64);
+    memcpy(data->data() + countOffset, &rowCount, sizeof(rowCount));
+    memcpy(data->data() + countOffset + sizeof(rowCount), &rowBytes, sizeof(rowBytes));
+
+    Entry entry;
+    entry.Storage = data;
+    entry.Data = data->data();
+    entry.Size = data->size();
+
+    char const* pos = entry.Data;
+    ParseEntry(pos, entry.Data + entry.Size, entry);
+
+    ResultSet* stored = new ResultSet(entry.Metadata, entry.Rows, entry.RowCount, entry.Storage);
+
+    std::unique_lock<std::shared_mutex> guard(_lock);
+    std::string_view key = entry.Sql;
+    if (_entries.emplace(key, std::move(entry)).second)
+        _dirty = true;
+
+    return stored;
+}
+
+void QuerySnapshot::Save()
+{
+    std::unique_lock<std::shared_mutex> guard(_lock);
+    if (!_dirty)
+        return;
+
+    std::string const tempPath = _path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        LOG_ERROR("sql.driver", "Could not open {} to write the query snapshot.", tempPath);
+        return;
+    }
+
+    std::string header;
+    header.append(SnapshotMagic, sizeof(SnapshotMagic));
+    Append(header, SnapshotVersion);
+    AppendString(header, _state);
+    Append(header, uint32(_entries.size()));
+
+    bool written = fwrite(header.data(), 1, header.size(), file) == header.size();
+    for (auto const& [sql, entry] : _entries)
+        written = written && fwrite(entry.Data, 1, entry.Size, file) == entry.Size;
+
+    written = fclose(file) == 0 && written;
+
+    std::size_t const entryCount = _entries.size();
+
+    // Drop the mapping of the old file before replacing it
+    _entries.clear();
+    _dirty = false;
+
+    std::error_code error;
+    if (written)
+        std::filesystem::rename(tempPath, _path, error);
+
+    if (!written || error)
+    {
+        LOG_ERROR("sql.driver", "Could not write query snapshot {}.", _path);
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    LOG_INFO("sql.driver", "Wrote {} query result(s) to snapshot {}.", entryCount, _path);
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERYSNAPSHOT_H
+#define _QUERYSNAPSHOT_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Field.h"
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+    @class QuerySnapshot
+    @brief On-disk copy of the results of string queries, keyed by the query text.
+
+    The file is memory-mapped and fields of the returned results point straight into it.
+    A snapshot belongs to one database state (e.g. the applied updates), a file written
+    for another state is ignored. Queries it has no result for are recorded and the file
+    is rewritten by Save().
+*/
+class AC_DATABASE_API QuerySnapshot
+{
+public:
+    QuerySnapshot(std::string path, std::string state);
+    ~QuerySnapshot();
+
+    QuerySnapshot(QuerySnapshot const&) = delete;
+    QuerySnapshot& operator=(QuerySnapshot const&) = delete;
+
+    //! Number of results loaded from the file
+    [[nodiscard]] std::size_t GetLoadedCount() const { return _loadedCount; }
+
+    //! Returns the stored result of the query or nullptr if there is none
+    ResultSet* Find(std::string_view sql) const;
+
+    //! Reads all rows of a result fetched from the database into the snapshot.
+    //! Takes ownership of result and returns a result reading the stored copy instead.
+    ResultSet* Store(std::string_view sql, ResultSet* result);
+
+    //! Writes the file if any result was added since it was loaded
+    void Save();
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<void const> Storage;
+        char const* Data = nullptr;           // whole entry, as written to the file
+        std::size_t Size = 0;
+        std::string_view Sql;
+        std::vector<QueryResultFieldMetadata> Metadata;
+        char const* Rows = nullptr;
+        uint64 RowCount = 0;
+    };
+
+    void Load();
+    static bool ParseEntry(char const*& pos, char const* end, Entry& entry);
+
+    std::string _path;
+    std::string _state;
+
+    mutable std::shared_mutex _lock;
+    std::unordered_map<std::string_view, Entry> _entries;
+    std::size_t _loadedCount = 0;
+    bool _dirty = false;
+};
+
+#endif
@@ -20,6 +20,8 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
+#include <memory>
 #include <variant>
 
 //- Type specifier of our element data
@@ -36,7 +38,18 @@ struct SQLElementData
     SQLElementDataType type;
 };
 
+//- Queue statistics of operations other than a single prepared statement are collected under these ids
+enum SQLStatementId : uint32
+{
+    SQL_STATEMENT_ID_ADHOC          = 0xFFFFFF00,
+    SQL_STATEMENT_ID_TRANSACTION,
+    SQL_STATEMENT_ID_QUERY_HOLDER,
+    SQL_STATEMENT_ID_OTHER
+};
+
+class DatabaseQueueStats;
 class MySQLConnection;
+class PreparedResultCache;
 
 class AC_DATABASE_API SQLOperation
 {
@@ -51,10 +64,26 @@ public:
     }
 
     virtual bool Execute() = 0;
+
+    //! One-way operations without result, the async workers may run several of them in one transaction
+    [[nodiscard]] virtual bool IsBatchable() const { return false; }
+
+    //! Prepared statement index or SQLStatementId, queue statistics are collected per id
+    [[nodiscard]] virtual uint32 GetStatementId() const { return SQL_STATEMENT_ID_OTHER; }
+
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
     MySQLConnection* m_conn{nullptr};
 
+    //! Set when the operation is queued for the async workers
+    TimePoint m_queuedTime;
+    DatabaseQueueStats* m_queueStats{nullptr};
+
+    //! Queries look up their results here first, if the pool has a result cache
+    PreparedResultCache* m_resultCache{nullptr};
+    //! Cached results a write changes are dropped again when this is released, after the operation was executed
+    std::shared_ptr<void> m_cacheWrite;
+
 private:
     SQLOperation(SQLOperation const& right) = delete;
     SQLOperation& operator=(SQLOperation const& right) = delete;
@@ -31,6 +31,7 @@ class AC_DATABASE_API TransactionBase
 {
     friend class TransactionTask;
     friend class MySQLConnection;
+    friend class PreparedResultCache;
 
     template <typename T>
     friend class DatabaseWorkerPool;
@@ -83,6 +84,8 @@ public:
     TransactionTask(std::shared_ptr<TransactionBase> trans) : m_trans(std::move(trans)) { }
     ~TransactionTask() override = default;
 
+    [[nodiscard]] uint32 GetStatementId() const override { return SQL_STATEMENT_ID_TRANSACTION; }
+
 protected:
     bool Execute() override;
     int TryExecute();
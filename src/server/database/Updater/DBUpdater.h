@@ -80,6 +80,9 @@ public:
     static bool Update(DatabaseWorkerPool<T>& pool, std::vector<std::string> const* setDirectories);
     static bool Populate(DatabaseWorkerPool<T>& pool);
 
+    //! Hash over all applied updates, changes whenever an update is applied, reapplied or removed
+    static std::string GetStateHash(DatabaseWorkerPool<T>& pool);
+
     // module
     static std::string GetDBModuleName();
 
@@ -30,6 +30,7 @@
 #include "MoveSplineInit.h"
 #include "ObjectDefines.h"
 #include "ObjectMgr.h"
+#include "Profiler.h"
 #include "ScriptedCreature.h"
 #include "ScriptedGossip.h"
 #include "SmartAI.h"
@@ -134,27 +135,24 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    auto bounds = std::equal_range(mEventIndex.begin(), mEventIndex.end(), std::make_pair(uint32(e), uint32(0)),
+        [](std::pair<uint32, uint32> const& left, std::pair<uint32, uint32> const& right) { return left.first < right.first; });
+
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        SmartScriptHolder& holder = mEvents[itr->second];
+        ConditionList const& conds = sConditionMgr->GetConditionsForSmartEvent(holder.entryOrGuid, holder.event_id, holder.source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
-        if (eventType == e)
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
         {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
-
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+            ASSERT(executionStack.empty());
+            executionStack.emplace_back(SmartScriptFrame{ holder, unit, var0, var1, bvar, spell, gob });
+            while (!executionStack.empty())
             {
-                ASSERT(executionStack.empty());
-                executionStack.emplace_back(SmartScriptFrame{ *i, unit, var0, var1, bvar, spell, gob });
-                while (!executionStack.empty())
-                {
-                    auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
-                    executionStack.pop_back();
-                    ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
-                }
+                auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+                executionStack.pop_back();
+                ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
             }
         }
     }
@@ -3320,7 +3318,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     // xinef: extended by selfs victim
-    ConditionList const conds = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
+    ConditionList const& conds = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
     ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
     if (sConditionMgr->IsObjectMeetToConditions(info, conds))
@@ -4044,6 +4042,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
     if (!(e.event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
         return;
 
+    ACORE_PROFILE_SCOPE("SmartScript {} event {}", e.entryOrGuid, e.event_id);
+
     switch (e.GetEventType())
     {
         case SMART_EVENT_LINK://special handling
@@ -4980,6 +4980,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -4993,6 +4994,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
@@ -5056,6 +5058,24 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+void SmartScript::BuildEventIndex()
+{
+    mEventIndex.clear();
+    mEventIndex.reserve(mEvents.size());
+
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+    {
+        // links are only reached through the event they are linked from
+        if (mEvents[i].GetEventType() == SMART_EVENT_LINK)
+            continue;
+
+        mEventIndex.emplace_back(mEvents[i].GetEventType(), i);
+    }
+
+    // (type, position) order keeps events of the same type in mEvents (priority) order
+    std::sort(mEventIndex.begin(), mEventIndex.end());
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1200;
@@ -5145,6 +5165,8 @@ void SmartScript::GetScript()
         e = sSmartScriptMgr->GetScript((int32)trigger->entry, mScriptType);
         FillScript(e, nullptr, trigger);
     }
+
+    BuildEventIndex();
 }
 
 void SmartScript::OnInitialize(WorldObject* obj, AreaTrigger const* at)
@@ -214,10 +214,13 @@ private:
     bool IsInPhase(uint32 p) const;
 
     void SortEvents(SmartAIEventList& events);
+    void BuildEventIndex();
     void RaisePriority(SmartScriptHolder& e);
     void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
     SmartAIEventList mEvents;
+    // (event type, position in mEvents), rebuilt whenever mEvents is filled, extended or sorted
+    std::vector<std::pair<uint32, uint32>> mEventIndex;
     SmartAIEventList mInstallEvents;
     SmartAIEventList mTimedActionList;
     bool isProcessingTimedActionList;
@@ -300,12 +300,31 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 }
 
 //============================================================
-// Check if the list is dirty and sort if necessary
+// Check if the list is dirty and restore the order if necessary
+// Between two updates only a few references change their threat, so instead of sorting the
+// whole list again each reference is moved in front of its lower threat predecessors.
+// That touches every entry once plus the distance the changed ones move, and keeps equal
+// threats in their previous order just like the stable sort did.
 
 void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Acore::ThreatOrderPred());
+    {
+        for (StorageType::iterator itr = std::next(iThreatList.begin()); itr != iThreatList.end();)
+        {
+            StorageType::iterator next = std::next(itr);
+            float threat = (*itr)->GetThreat();
+
+            StorageType::iterator pos = itr;
+            while (pos != iThreatList.begin() && (*std::prev(pos))->GetThreat() < threat)
+                --pos;
+
+            if (pos != itr)
+                iThreatList.splice(pos, iThreatList, itr);
+
+            itr = next;
+        }
+    }
 
     iDirty = false;
 }
@@ -607,15 +626,13 @@ void ThreatMgr::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusCh
                     if (Unit* target = ObjectAccessor::GetUnit(*GetOwner(), hostileRef->getUnitGuid()))
                         if (GetOwner()->IsInMap(target))
                             GetOwner()->SendRemoveFromThreatListOpcode(hostileRef);
-                iThreatContainer.remove(hostileRef);
-                iThreatOfflineContainer.addReference(hostileRef);
+                iThreatOfflineContainer.moveReference(iThreatContainer, hostileRef);
             }
             else
             {
                 if (getCurrentVictim() && hostileRef->GetThreat() > (1.1f * getCurrentVictim()->GetThreat()))
                     setDirty(true);
-                iThreatContainer.addReference(hostileRef);
-                iThreatOfflineContainer.remove(hostileRef);
+                iThreatContainer.moveReference(iThreatOfflineContainer, hostileRef);
             }
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
@@ -46,6 +46,8 @@ struct ThreatCalcHelper
 //==============================================================
 class HostileReference : public Reference<Unit, ThreatMgr>
 {
+    friend class ThreatContainer;
+
 public:
     HostileReference(Unit* refUnit, ThreatMgr* threatMgr, float threat);
 
@@ -134,6 +136,7 @@ private:
     float iTempThreatModifier;                          // used for taunt
     ObjectGuid iUnitGuid;
     bool iOnline;
+    std::list<HostileReference*>::iterator iPosition;   // entry in the threat list of the container holding this reference
 };
 
 //==============================================================
@@ -178,17 +181,23 @@ public:
 private:
     void remove(HostileReference* hostileRef)
     {
-        iThreatList.remove(hostileRef);
+        iThreatList.erase(hostileRef->iPosition);
     }
 
     void addReference(HostileReference* hostileRef)
     {
-        iThreatList.push_back(hostileRef);
+        hostileRef->iPosition = iThreatList.insert(iThreatList.end(), hostileRef);
+    }
+
+    // Move a reference from another container to the end of this one without reallocating the list entry
+    void moveReference(ThreatContainer& from, HostileReference* hostileRef)
+    {
+        iThreatList.splice(iThreatList.end(), from.iThreatList, hostileRef->iPosition);
     }
 
     void clearReferences();
 
-    // Sort the list if necessary
+    // Restore the threat order if necessary
     void update();
 
     StorageType iThreatList;
@@ -19,6 +19,7 @@
 #include "BattlegroundMgr.h"
 #include "DBCFileLoader.h"
 #include "DBCfmt.h"
+#include "Duration.h"
 #include "Errors.h"
 #include "LFGMgr.h"
 #include "Log.h"
@@ -26,7 +27,11 @@
 #include "SpellMgr.h"
 #include "TransportMgr.h"
 #include "World.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <map>
+#include <thread>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -209,13 +214,21 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
     return false;
 }
 
+// One store of LoadDBCStores, stores do not depend on each other until all of them are loaded
+struct DBCStoreLoad
+{
+    std::string FileName;
+    std::function<void(StoreProblemList&)> Load;
+    StoreProblemList Errors;
+    Microseconds Time = 0us;
+};
+
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
+inline void LoadDBC(std::atomic<uint32>& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
     std::string dbcFilename = dbcPath + filename;
     bool existDBData = false;
 
@@ -232,7 +245,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
             localizedName.append(filename);
 
             if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1 << i);             // mark as not available for speedup next checks
+                availableDbcLocales.fetch_and(~(1 << i));     // mark as not available for speedup next checks
         }
     }
 
@@ -258,6 +271,56 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     }
 }
 
+static void LoadDBCStoresParallel(std::vector<DBCStoreLoad>& loads, uint32 threadCount)
+{
+    if (!threadCount)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    threadCount = std::min<uint32>(threadCount, loads.size());
+
+    std::atomic<std::size_t> nextLoad = 0;
+    auto worker = [&]()
+    {
+        for (std::size_t i = nextLoad++; i < loads.size(); i = nextLoad++)
+        {
+            DBCStoreLoad& load = loads[i];
+            TimePoint start = std::chrono::steady_clock::now();
+            load.Load(load.Errors);
+            load.Time = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32 i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+static void PrintDBCLoadTimes(std::vector<DBCStoreLoad> const& loads)
+{
+    std::vector<DBCStoreLoad const*> sorted;
+    sorted.reserve(loads.size());
+    for (DBCStoreLoad const& load : loads)
+        sorted.push_back(&load);
+
+    std::sort(sorted.begin(), sorted.end(), [](DBCStoreLoad const* left, DBCStoreLoad const* right) { return left->Time > right->Time; });
+
+    Microseconds total = 0us;
+    for (DBCStoreLoad const* load : sorted)
+    {
+        total += load->Time;
+        LOG_DEBUG("dbc", "{:<40} {:>8.2f} ms", load->FileName, load->Time.count() / 1000.0);
+    }
+
+    LOG_INFO("server.loading", ">> Data store load time summed over all stores: {:.2f} ms, slowest:", total.count() / 1000.0);
+    for (std::size_t i = 0; i < std::min<std::size_t>(sorted.size(), 10); ++i)
+        LOG_INFO("server.loading", "   {:<40} {:>8.2f} ms", sorted[i]->FileName, sorted[i]->Time.count() / 1000.0);
+}
+
 void LoadDBCStores(const std::string& dataPath)
 {
     uint32 oldMSTime = getMSTime();
@@ -265,9 +328,10 @@ void LoadDBCStores(const std::string& dataPath)
     std::string dbcPath = dataPath + "dbc/";
 
     StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
+    std::atomic<uint32> availableDbcLocales = 0xFFFFFFFF;
+    std::vector<DBCStoreLoad> loads;
 
-#define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
+#define LOAD_DBC(store, file, dbtable) loads.push_back({ file, [&](StoreProblemList& errors) { LoadDBC(availableDbcLocales, errors, store, dbcPath, file, dbtable); } })
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
     LOAD_DBC(sAchievementStore,                     "Achievement.dbc",                      "achievement_dbc");
@@ -384,6 +448,15 @@ void LoadDBCStores(const std::string& dataPath)
 
 #undef LOAD_DBC
 
+    LoadDBCStoresParallel(loads, sWorld->getIntConfig(CONFIG_DBC_LOAD_THREADS));
+
+    DBCFileCount = loads.size();
+    for (DBCStoreLoad& load : loads)
+        bad_dbc_files.splice(bad_dbc_files.end(), load.Errors);
+
+    PrintDBCLoadTimes(loads);
+
+    // everything below links stores together and runs on this thread only
     for (CharStartOutfitEntry const* outfit : sCharStartOutfitStore)
         sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
@@ -36,6 +36,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "ScriptedGossip.h"
 #include "SpellAuraEffects.h"
@@ -831,6 +832,7 @@ void Creature::Update(uint32 diff)
             {
                 // do not allow the AI to be changed during update
                 m_AI_locked = true;
+                ACORE_PROFILE_SCOPE("CreatureAI {}", GetEntry());
                 i_AI->UpdateAI(diff);
                 m_AI_locked = false;
             }
@@ -14583,11 +14583,7 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     stmt->SetData (1, m_entryPointData.joinPos.GetPositionX());
     stmt->SetData (2, m_entryPointData.joinPos.GetPositionY());
@@ -14597,6 +14593,18 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(6, m_entryPointData.taxiPath[0]);
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
+
+    if (!m_saveCache.Update(SAVE_CACHE_ENTRY_POINT, stmt))
+    {
+        PlayerSaveCache::CountSkipped(stmt);
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* delStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
+    delStmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(delStmt);
+
     trans->Append(stmt);
 }
 
@@ -15853,18 +15861,42 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
-    stmt->SetData(0, GetSession()->GetAccountId());
-    trans->Append(stmt);
+    // the rows are rewritten together, but only if any of them changed
+    bool changed = !m_saveCache.BeginSave(SAVE_CACHE_INSTANCE_TIMES, false);
 
+    std::vector<CharacterDatabasePreparedStatement*> statements;
     for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end(); ++itr)
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
         stmt->SetData(0, GetSession()->GetAccountId());
         stmt->SetData(1, itr->first);
         stmt->SetData(2, (int64)itr->second);
-        trans->Append(stmt);
+        if (m_saveCache.Update(SAVE_CACHE_INSTANCE_TIMES, stmt))
+            changed = true;
+
+        statements.push_back(stmt);
     }
+
+    if (!m_saveCache.EndSave(SAVE_CACHE_INSTANCE_TIMES).empty())
+        changed = true;
+
+    if (!changed)
+    {
+        for (CharacterDatabasePreparedStatement* stmt : statements)
+        {
+            PlayerSaveCache::CountSkipped(stmt);
+            delete stmt;
+        }
+
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
+    stmt->SetData(0, GetSession()->GetAccountId());
+    trans->Append(stmt);
+
+    for (CharacterDatabasePreparedStatement* insStmt : statements)
+        trans->Append(insStmt);
 }
 
 bool Player::IsInWhisperWhiteList(ObjectGuid guid)
@@ -33,6 +33,7 @@
 #include "ObjectMgr.h"
 #include "Optional.h"
 #include "PetDefines.h"
+#include "PlayerSaveCache.h"
 #include "PlayerSettings.h"
 #include "PlayerTaxi.h"
 #include "QuestDef.h"
@@ -1591,6 +1592,8 @@ public:
 
     void SaveToDB(bool create, bool logout);
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
+    // Commits a transaction holding a save, if it fails the next save writes every table completely
+    void CommitSaveTransaction(CharacterDatabaseTransaction trans);
     void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
     void SaveGoldToDB(CharacterDatabaseTransaction trans);
     void _SaveSkills(CharacterDatabaseTransaction trans);
@@ -2373,6 +2376,8 @@ public:
 
     [[nodiscard]] uint32 GetSaveTimer() const { return m_nextSave; }
     void SetSaveTimer(uint32 timer) { m_nextSave = timer; }
+    // Rows with pending changes for the next save, used to order queued autosaves
+    [[nodiscard]] std::size_t GetSaveBacklog() const { return m_itemUpdateQueue.size() + m_QuestStatusSave.size() + m_RewardedQuestsSave.size(); }
 
     // Recall position
     uint32 m_recallMap;
@@ -2797,6 +2802,8 @@ protected:
     uint32 m_nextSave; // pussywizard
     uint16 m_additionalSaveTimer; // pussywizard
     uint8 m_additionalSaveMask; // pussywizard
+    PlayerSaveCache m_saveCache; // rows of tables without own change tracking, as last saved
+    AsyncCallbackProcessor<TransactionCallback> m_saveCallbacks; // commits of saves that used m_saveCache
     uint16 m_hostileReferenceCheckTimer; // pussywizard
     std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
     Difficulty m_dungeonDifficulty;
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerSaveCache.h"
+#include "DatabaseEnv.h"
+#include "Errors.h"
+#include <atomic>
+#include <string_view>
+
+namespace
+{
+    // Number of leading statement parameters forming the primary key of each table
+    constexpr std::array<uint8, MAX_SAVE_CACHE_TABLES> KeyColumns =
+    {
+        5, // character_aura: guid, casterGuid, itemGuid, spell, effectMask
+        1, // character_entry_point: guid
+        1, // character_stats: guid
+        2, // account_instance_times: accountId, instanceId
+        2  // character_settings: guid, source
+    };
+
+    std::atomic<uint64> SkippedStatements{};
+    std::atomic<uint64> SkippedBytes{};
+
+    std::size_t GetSize(PreparedStatementData const& value)
+    {
+        return std::visit([](auto const& data) -> std::size_t
+        {
+            using T = std::decay_t<decltype(data)>;
+            if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<uint8>>)
+                return data.size();
+            else if constexpr (std::is_same_v<T, std::nullptr_t>)
+                return 0;
+            else
+                return sizeof(T);
+        }, value.data);
+    }
+
+    bool Equals(std::vector<PreparedStatementData> const& left, std::vector<PreparedStatementData> const& right, std::size_t count)
+    {
+        if (left.size() < count || right.size() < count)
+            return false;
+
+        for (std::size_t i = 0; i < count; ++i)
+            if (left[i].data != right[i].data)
+                return false;
+
+        return true;
+    }
+}
+
+std::size_t PlayerSaveCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = 0;
+    for (PreparedStatementData const& value : key)
+    {
+        std::size_t valueHash = std::visit([](auto const& data) -> std::size_t
+        {
+            using T = std::decay_t<decltype(data)>;
+            if constexpr (std::is_same_v<T, std::vector<uint8>>)
+                return std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(data.data()), data.size()));
+            else if constexpr (std::is_same_v<T, std::nullptr_t>)
+                return 0;
+            else
+                return std::hash<T>()(data);
+        }, value.data);
+
+        hash ^= valueHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+}
+
+bool PlayerSaveCache::KeyEqual::operator()(Key const& left, Key const& right) const
+{
+    return left.size() == right.size() && Equals(left, right, left.size());
+}
+
+void PlayerSaveCache::Reset()
+{
+    for (TableRows& table : _tables)
+    {
+        table.Rows.clear();
+        table.Known = false;
+    }
+}
+
+bool PlayerSaveCache::BeginSave(PlayerSaveCacheTable table, bool full)
+{
+    TableRows& rows = _tables[table];
+    if (full || !rows.Known)
+    {
+        rows.Rows.clear();
+        rows.Known = false;
+        return false;
+    }
+
+    for (auto& [key, row] : rows.Rows)
+        row.Saved = false;
+
+    return true;
+}
+
+std::vector<PlayerSaveCache::Key> PlayerSaveCache::EndSave(PlayerSaveCacheTable table)
+{
+    TableRows& rows = _tables[table];
+
+    std::vector<Key> removed;
+    for (auto itr = rows.Rows.begin(); itr != rows.Rows.end();)
+    {
+        if (itr->second.Saved)
+        {
+            ++itr;
+            continue;
+        }
+
+        removed.push_back(itr->first);
+        itr = rows.Rows.erase(itr);
+    }
+
+    rows.Known = true;
+    return removed;
+}
+
+bool PlayerSaveCache::Update(PlayerSaveCacheTable table, PreparedStatementBase const* stmt)
+{
+    std::vector<PreparedStatementData> const& values = stmt->GetParameters();
+    ASSERT(values.size() >= KeyColumns[table]);
+
+    Key key(values.begin(), values.begin() + KeyColumns[table]);
+    Row& row = _tables[table].Rows[std::move(key)];
+    row.Saved = true;
+
+    if (row.Values.size() == values.size() && Equals(row.Values, values, values.size()))
+        return false;
+
+    row.Values = values;
+    return true;
+}
+
+bool PlayerSaveCache::Append(CharacterDatabaseTransaction trans, PlayerSaveCacheTable table, CharacterDatabasePreparedStatement* stmt)
+{
+    if (!Update(table, stmt))
+    {
+        CountSkipped(stmt);
+        delete stmt;
+        return false;
+    }
+
+    trans->Append(stmt);
+    return true;
+}
+
+void PlayerSaveCache::CountSkipped(PreparedStatementBase const* stmt)
+{
+    std::size_t bytes = 0;
+    for (PreparedStatementData const& value : stmt->GetParameters())
+        bytes += GetSize(value);
+
+    SkippedStatements.fetch_add(1, std::memory_order_relaxed);
+    SkippedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+PlayerSaveCacheStats PlayerSaveCache::GetStats()
+{
+    PlayerSaveCacheStats stats;
+    stats.SkippedStatements = SkippedStatements.load(std::memory_order_relaxed);
+    stats.SkippedBytes = SkippedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_SAVE_CACHE_H
+#define _PLAYER_SAVE_CACHE_H
+
+#include "DatabaseEnvFwd.h"
+#include "PreparedStatement.h"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+enum PlayerSaveCacheTable : uint8
+{
+    SAVE_CACHE_AURAS,
+    SAVE_CACHE_ENTRY_POINT,
+    SAVE_CACHE_STATS,
+    SAVE_CACHE_INSTANCE_TIMES,
+    SAVE_CACHE_SETTINGS,
+
+    MAX_SAVE_CACHE_TABLES
+};
+
+struct PlayerSaveCacheStats
+{
+    uint64 SkippedStatements = 0;
+    uint64 SkippedBytes = 0;
+};
+
+/**
+    @class PlayerSaveCache
+    @brief Rows the saves of one player wrote to tables that have no change tracking of their own.
+
+    Each row is identified by its primary key, the leading parameters of the statement that
+    writes it. A save hands the statements it built to the cache, which drops those that would
+    write a row again with the values it already has. Rows written before the player logged in
+    are unknown, so the first save of a table after login (or after Reset) writes it completely.
+*/
+class AC_GAME_API PlayerSaveCache
+{
+public:
+    using Key = std::vector<PreparedStatementData>;
+
+    // Forget all saved rows, the next save of every table writes it completely
+    void Reset();
+
+    // Starts saving a table and returns false if the save has to write all of its rows,
+    // either because full is set or the rows in the database are not known yet
+    bool BeginSave(PlayerSaveCacheTable table, bool full);
+
+    // Returns the keys of rows written by earlier saves but not passed to Update in this one and forgets them
+    std::vector<Key> EndSave(PlayerSaveCacheTable table);
+
+    // Remembers the row the statement writes, returns false if it was saved with the same values before
+    bool Update(PlayerSaveCacheTable table, PreparedStatementBase const* stmt);
+
+    // Appends the statement if it changes its row, frees it otherwise. Returns true if appended
+    bool Append(CharacterDatabaseTransaction trans, PlayerSaveCacheTable table, CharacterDatabasePreparedStatement* stmt);
+
+    // Counts a statement a save did not have to send
+    static void CountSkipped(PreparedStatementBase const* stmt);
+
+    static PlayerSaveCacheStats GetStats();
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(Key const& left, Key const& right) const;
+    };
+
+    struct Row
+    {
+        std::vector<PreparedStatementData> Values;
+        bool Saved = false;                              // passed to Update during the current save
+    };
+
+    struct TableRows
+    {
+        std::unordered_map<Key, Row, KeyHash, KeyEqual> Rows;
+        bool Known = false;                              // Rows match the database
+    };
+
+    std::array<TableRows, MAX_SAVE_CACHE_TABLES> _tables;
+};
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerSaveScheduler.h"
+#include "DatabaseEnv.h"
+#include "GameTime.h"
+#include "Metric.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "World.h"
+#include "WorldSessionMgr.h"
+#include <algorithm>
+#include <vector>
+
+PlayerSaveScheduler* PlayerSaveScheduler::instance()
+{
+    static PlayerSaveScheduler instance;
+    return &instance;
+}
+
+bool PlayerSaveScheduler::IsEnabled() const
+{
+    return sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_SCHEDULER);
+}
+
+void PlayerSaveScheduler::Enqueue(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _queue.emplace(guid, GameTime::GetGameTimeMS());
+}
+
+void PlayerSaveScheduler::Remove(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _queue.erase(guid);
+}
+
+void PlayerSaveScheduler::Update(uint32 diff)
+{
+    uint32 const interval = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+    uint32 const statementsPerSecond = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_STATEMENTS_PER_SECOND);
+
+    // Every online player is saved once per interval, a quarter more leaves room to work off a backlog.
+    // At most one second worth of budget is kept so an idle period does not end in a burst.
+    if (interval)
+    {
+        double savesPerMs = sWorldSessionMgr->GetPlayerCount() * 1.25 / interval;
+        _saveBudget = std::min(_saveBudget + savesPerMs * diff, std::max(1.0, savesPerMs * IN_MILLISECONDS));
+    }
+
+    if (statementsPerSecond)
+        _statementBudget = std::min(_statementBudget + double(statementsPerSecond) * diff / IN_MILLISECONDS, double(statementsPerSecond));
+
+    struct Candidate
+    {
+        Player* player;
+        Milliseconds waited;
+        uint64 priority;
+    };
+
+    Milliseconds const now = GameTime::GetGameTimeMS();
+    std::vector<Candidate> candidates;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_queue.empty())
+            return;
+
+        for (auto itr = _queue.begin(); itr != _queue.end();)
+        {
+            Player* player = ObjectAccessor::FindPlayer(itr->first);
+            if (!player)
+            {
+                itr = _queue.erase(itr);
+                continue;
+            }
+
+            // every pending row counts as much as a second of waiting
+            Milliseconds waited = now - itr->second;
+            candidates.push_back({ player, waited, uint64(waited.count()) + player->GetSaveBacklog() * IN_MILLISECONDS });
+            ++itr;
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](Candidate const& left, Candidate const& right) { return left.priority > right.priority; });
+
+    std::size_t const maxQueueSize = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_MAX_DB_QUEUE);
+    bool const databaseBusy = maxQueueSize && CharacterDatabase.QueueSize() >= maxQueueSize;
+
+    uint32 saved = 0;
+    std::size_t statements = 0;
+
+    for (Candidate const& candidate : candidates)
+    {
+        // saved by the delayed operation once the far teleport finished
+        if (candidate.player->IsBeingTeleportedFar())
+            continue;
+
+        // players waiting for a whole interval are saved no matter the load, that bounds what a crash can lose
+        if (candidate.waited < Milliseconds(interval))
+        {
+            if (databaseBusy || _saveBudget < 1.0 || (statementsPerSecond && _statementBudget <= 0.0))
+                continue;
+        }
+
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        candidate.player->SaveToDB(trans, false, false);
+        std::size_t const size = trans->GetSize();
+        candidate.player->CommitSaveTransaction(trans);
+
+        _saveBudget -= 1.0;
+        _statementBudget -= size;
+
+        ++saved;
+        statements += size;
+    }
+
+    std::size_t queued;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        queued = _queue.size();
+    }
+
+    METRIC_VALUE("player_save_queue", uint64(queued));
+    if (saved)
+    {
+        METRIC_VALUE("player_save_saves", saved);
+        METRIC_VALUE("player_save_statements", uint64(statements));
+    }
+}
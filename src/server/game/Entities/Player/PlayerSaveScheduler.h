@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_SAVE_SCHEDULER_H
+#define _PLAYER_SAVE_SCHEDULER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include <mutex>
+#include <unordered_map>
+
+/**
+    @class PlayerSaveScheduler
+    @brief Spreads player autosaves over time instead of saving each player the moment its timer expires.
+
+    Players whose save timer expired are queued from the map threads. The world thread
+    saves them after the maps were updated, as many per tick as the save rate and the
+    statement budget allow, most overdue and most changed players first. While the
+    character database queue is too long only players overdue by a full save interval
+    are saved.
+*/
+class AC_GAME_API PlayerSaveScheduler
+{
+public:
+    static PlayerSaveScheduler* instance();
+
+    [[nodiscard]] bool IsEnabled() const;
+
+    // Queues an autosave, called by Player::Update when the save timer expires
+    void Enqueue(ObjectGuid guid);
+
+    // Drops a queued autosave after the player was saved for another reason
+    void Remove(ObjectGuid guid);
+
+    // Saves queued players, must be called while the maps are not updated
+    void Update(uint32 diff);
+
+private:
+    std::mutex _lock;
+    std::unordered_map<ObjectGuid, Milliseconds> _queue; // player -> game time the save became due
+
+    double _saveBudget = 0.0;
+    double _statementBudget = 0.0;
+};
+
+#define sPlayerSaveScheduler PlayerSaveScheduler::instance()
+
+#endif
@@ -91,7 +91,7 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         stmt->SetData(0, GetGUID().GetCounter());
         stmt->SetData(1, source);
         stmt->SetData(2, data.str());
-        trans->Append(stmt);
+        m_saveCache.Append(trans, SAVE_CACHE_SETTINGS, stmt);
     }
 }
 
@@ -47,6 +47,7 @@
 #include "OutdoorPvP.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "ReputationMgr.h"
@@ -7067,7 +7068,17 @@ void Player::SaveToDB(bool create, bool logout)
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CommitSaveTransaction(trans);
+}
+
+void Player::CommitSaveTransaction(CharacterDatabaseTransaction trans)
+{
+    m_saveCallbacks.AddCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete([this](bool success)
+    {
+        // the cache already holds the rows of the failed save, they are not in the database
+        if (!success)
+            m_saveCache.Reset();
+    });
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
@@ -7082,10 +7093,20 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
         return;
     }
 
+    // saved now, a queued autosave is no longer needed
+    sPlayerSaveScheduler->Remove(GetGUID());
+
     // pussywizard: full save now, so clear partial additional saves
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
 
+    // learn about failed commits of earlier saves before relying on the rows they wrote
+    m_saveCallbacks.ProcessReadyCallbacks();
+
+    // logout and character creation write every table completely, autosaves skip unchanged rows
+    if (create || logout || !sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_SKIP_UNCHANGED))
+        m_saveCache.Reset();
+
     // first save/honor gain after midnight will also update the player's honor fields
     UpdateHonorFields();
 
@@ -7196,9 +7217,16 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+
+    // a full save replaces all rows, otherwise only changed auras are written and removed ones deleted
+    bool delta = m_saveCache.BeginSave(SAVE_CACHE_AURAS, logout || !sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_SKIP_UNCHANGED));
+    if (!delta)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->SetData(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+    }
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -7231,7 +7259,7 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         }
 
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(delta ? CHAR_REP_AURA : CHAR_INS_AURA);
         stmt->SetData(index++, GetGUID().GetCounter());
         stmt->SetData(index++, itr->second->GetCasterGUID().GetRawValue());
         stmt->SetData(index++, itr->second->GetCastItemGUID().GetRawValue());
@@ -7248,6 +7276,14 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         stmt->SetData(index++, itr->second->GetMaxDuration());
         stmt->SetData(index++, itr->second->GetDuration());
         stmt->SetData(index, itr->second->GetCharges());
+        m_saveCache.Append(trans, SAVE_CACHE_AURAS, stmt);
+    }
+
+    for (PlayerSaveCache::Key const& key : m_saveCache.EndSave(SAVE_CACHE_AURAS))
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_KEY);
+        for (uint8 i = 0; i < key.size(); ++i)
+            stmt->SetData(i, key[i]);
         trans->Append(stmt);
     }
 }
@@ -7758,15 +7794,9 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     if (!sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE) || GetLevel() < sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabasePreparedStatement* stmt = nullptr;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
     stmt->SetData(index++, GetGUID().GetCounter());
     stmt->SetData(index++, GetMaxHealth());
 
@@ -7790,6 +7820,17 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     stmt->SetData(index++, GetBaseSpellPowerBonus());
     stmt->SetData(index++, GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + static_cast<uint16>(CR_CRIT_TAKEN_SPELL)));
 
+    if (!m_saveCache.Update(SAVE_CACHE_STATS, stmt))
+    {
+        PlayerSaveCache::CountSkipped(stmt);
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* delStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
+    delStmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(delStmt);
+
     trans->Append(stmt);
 }
 
@@ -30,6 +30,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SpellAuraEffects.h"
@@ -322,9 +323,18 @@ void Player::Update(uint32 p_time)
     {
         if (p_time >= m_nextSave)
         {
-            // m_nextSave reset in SaveToDB call
-            SaveToDB(false, false);
-            LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            if (sPlayerSaveScheduler->IsEnabled())
+            {
+                // the world thread saves the player when the save rate allows it, the timer only restarts in case it does not
+                sPlayerSaveScheduler->Enqueue(GetGUID());
+                m_nextSave = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+            }
+            else
+            {
+                // m_nextSave reset in SaveToDB call
+                SaveToDB(false, false);
+                LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            }
         }
         else
         {
@@ -32,6 +32,7 @@
 #include "ThreatMgr.h"
 #include "UnitDefines.h"
 #include "UnitUtils.h"
+#include <boost/container/flat_map.hpp>
 #include <functional>
 #include <utility>
 
@@ -636,10 +637,10 @@ public:
     typedef std::vector<AuraEffect*> AuraEffectList;
     typedef std::list<Aura*> AuraList;
     typedef std::list<AuraApplication*> AuraApplicationList;
-    typedef std::list<DiminishingReturn> Diminishing;
+    typedef std::vector<DiminishingReturn> Diminishing;
     typedef GuidUnorderedSet ComboPointHolderSet;
 
-    typedef std::map<uint8, AuraApplication*> VisibleAuraMap;
+    typedef boost::container::flat_map<uint8, AuraApplication*> VisibleAuraMap;
 
     ~Unit() override;
 
@@ -36,26 +36,65 @@ void HashMapHolder<T>::Insert(T* o)
         || std::is_same<MotionTransport, T>::value,
         "Only Player and Motion Transport can be registered in global HashMapHolder");
 
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    Counters& counters = GetCounters();
+    Shard& shard = GetShard(o->GetGUID());
+
+    std::unique_lock<std::shared_mutex> lock(*GetLock(), std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        ++counters.ContendedWrites;
+        lock.lock();
+    }
+
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    auto start = std::chrono::steady_clock::now();
 
     GetContainer()[o->GetGUID()] = o;
+    shard.Objects[o->GetGUID()] = o;
+
+    ++counters.Writes;
+    counters.WriteLockHoldTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    Counters& counters = GetCounters();
+    Shard& shard = GetShard(o->GetGUID());
+
+    std::unique_lock<std::shared_mutex> lock(*GetLock(), std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        ++counters.ContendedWrites;
+        lock.lock();
+    }
+
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    auto start = std::chrono::steady_clock::now();
 
     GetContainer().erase(o->GetGUID());
+    shard.Objects.erase(o->GetGUID());
+
+    ++counters.Writes;
+    counters.WriteLockHoldTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    Shard& shard = GetShard(guid);
+
+    std::shared_lock<std::shared_mutex> lock(shard.Lock, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        shard.ContendedLookups.fetch_add(1, std::memory_order_relaxed);
+        lock.lock();
+    }
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    shard.Lookups.fetch_add(1, std::memory_order_relaxed);
+
+    typename MapType::iterator itr = shard.Objects.find(guid);
+    return (itr != shard.Objects.end()) ? itr->second : nullptr;
 }
 
 template<class T>
@@ -72,6 +111,44 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+HashMapHolderStats HashMapHolder<T>::GetStats()
+{
+    Counters const& counters = GetCounters();
+
+    HashMapHolderStats stats;
+    for (Shard const& shard : GetShards())
+    {
+        stats.Lookups += shard.Lookups.load(std::memory_order_relaxed);
+        stats.ContendedLookups += shard.ContendedLookups.load(std::memory_order_relaxed);
+    }
+
+    stats.Writes = counters.Writes.load(std::memory_order_relaxed);
+    stats.ContendedWrites = counters.ContendedWrites.load(std::memory_order_relaxed);
+    stats.WriteLockHoldTimeNs = counters.WriteLockHoldTimeNs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+template<class T>
+auto HashMapHolder<T>::GetShards() -> std::array<Shard, SHARD_COUNT>&
+{
+    static std::array<Shard, SHARD_COUNT> _shards;
+    return _shards;
+}
+
+template<class T>
+auto HashMapHolder<T>::GetShard(ObjectGuid guid) -> Shard&
+{
+    return GetShards()[guid.GetCounter() % SHARD_COUNT];
+}
+
+template<class T>
+auto HashMapHolder<T>::GetCounters() -> Counters&
+{
+    static Counters _counters;
+    return _counters;
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "GridDefines.h"
 #include "Object.h"
+#include <array>
+#include <atomic>
 #include <shared_mutex>
 
 class Creature;
@@ -36,6 +38,15 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 
+struct HashMapHolderStats
+{
+    uint64 Lookups = 0;
+    uint64 ContendedLookups = 0;
+    uint64 Writes = 0;
+    uint64 ContendedWrites = 0;
+    uint64 WriteLockHoldTimeNs = 0;
+};
+
 template <class T>
 class HashMapHolder
 {
@@ -43,6 +54,9 @@ class HashMapHolder
     HashMapHolder() = default;
 
 public:
+    // Lookups by guid only touch one shard, so concurrent Find calls from map threads
+    // do not serialize on the lock guarding the full container used for iteration
+    static constexpr std::size_t SHARD_COUNT = 16;
 
     typedef std::unordered_map<ObjectGuid, T*> MapType;
 
@@ -52,9 +66,35 @@ public:
 
     static T* Find(ObjectGuid guid);
 
+    // Full container, only meant for iteration while holding GetLock()
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+    static HashMapHolderStats GetStats();
+
+private:
+    // Lookup counters live next to the lock of their shard, which Find writes to anyway
+    struct alignas(64) Shard
+    {
+        std::shared_mutex Lock;
+        MapType Objects;
+        std::atomic<uint64> Lookups{};
+        std::atomic<uint64> ContendedLookups{};
+    };
+
+    // Writes are serialized by GetLock(), these see no contention worth spreading
+    struct Counters
+    {
+        std::atomic<uint64> Writes{};
+        std::atomic<uint64> ContendedWrites{};
+        std::atomic<uint64> WriteLockHoldTimeNs{};
+    };
+
+    static std::array<Shard, SHARD_COUNT>& GetShards();
+    static Shard& GetShard(ObjectGuid guid);
+
+    static Counters& GetCounters();
 };
 
 namespace ObjectAccessor
@@ -2272,7 +2272,7 @@ void ObjectMgr::LoadCreatures()
     uint32 count = 0;
     do
     {
-        Field* fields = result->Fetch();
+        ResultRow fields = result->FetchRow();
 
         ObjectGuid::LowType spawnId     = fields[0].Get<uint32>();
         uint32 id1                      = fields[1].Get<uint32>();
@@ -2638,7 +2638,7 @@ void ObjectMgr::LoadGameobjects()
     _gameObjectDataStore.rehash(result->GetRowCount());
     do
     {
-        Field* fields = result->Fetch();
+        ResultRow fields = result->FetchRow();
 
         ObjectGuid::LowType guid    = fields[0].Get<uint32>();
         uint32 entry                = fields[1].Get<uint32>();
@@ -2907,7 +2907,7 @@ void ObjectMgr::LoadItemTemplates()
 
     do
     {
-        Field* fields = result->Fetch();
+        ResultRow fields = result->FetchRow();
 
         uint32 entry = fields[0].Get<uint32>();
 
@@ -4,6 +4,7 @@
 #include "Log.h"
 #include "MapDefines.h"
 #include <filesystem>
+#include <fstream>
 #include <G3D/Ray.h>
 
 uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
@@ -14,21 +15,87 @@ GridTerrainData::GridTerrainData()
     _gridGetHeight = &GridTerrainData::getHeightFromFlat;
 }
 
-TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
+// Sequential reader over the in-memory contents of a map file
+class GridTerrainData::FileReader
+{
+public:
+    FileReader(uint8 const* data, std::size_t size) : _data(data), _size(size), _pos(0) { }
+
+    void Seek(std::size_t offset) { _pos = offset; }
+
+    bool Read(void* dest, std::size_t size)
+    {
+        if (_pos > _size || _size - _pos < size)
+            return false;
+
+        memcpy(dest, _data + _pos, size);
+        _pos += size;
+        return true;
+    }
+
+    // Returns a view of the next count elements without copying them, empty if out of bounds.
+    // The extractor keeps every height array 4 byte aligned, anything else is rejected as corrupt.
+    template<class T>
+    std::span<T const> View(std::size_t count)
+    {
+        std::size_t const size = count * sizeof(T);
+        if (_pos > _size || _size - _pos < size || reinterpret_cast<uintptr_t>(_data + _pos) % alignof(T))
+            return {};
+
+        std::span<T const> view(reinterpret_cast<T const*>(_data + _pos), count);
+        _pos += size;
+        return view;
+    }
+
+private:
+    uint8 const* _data;
+    std::size_t _size;
+    std::size_t _pos;
+};
+
+TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName, bool memoryMapped /*= false*/)
 {
     // Check if file exists, we do this first as we need to
     // differentiate between file existing and any other file errors
     if (!std::filesystem::exists(mapFileName))
         return TerrainMapDataReadResult::NotFound;
 
-    // Start the input stream and check for any errors
-    std::ifstream fileStream(mapFileName, std::ios::binary);
-    if (fileStream.fail())
-        return TerrainMapDataReadResult::ReadError;
+    uint8 const* fileData = nullptr;
+    std::size_t fileSize = 0;
+    std::unique_ptr<uint8[]> fileBuffer;
+    if (memoryMapped)
+    {
+        // Mapped read only, the pages are shared with every other process using the same data directory
+        _mappedFile = Acore::MappedFile::Open(mapFileName);
+        if (!_mappedFile)
+            return TerrainMapDataReadResult::ReadError;
+
+        fileData = _mappedFile->GetData();
+        fileSize = _mappedFile->GetSize();
+    }
+    else
+    {
+        std::ifstream fileStream(mapFileName, std::ios::binary);
+        if (fileStream.fail())
+            return TerrainMapDataReadResult::ReadError;
+
+        std::error_code error;
+        fileSize = std::filesystem::file_size(mapFileName, error);
+        if (error)
+            return TerrainMapDataReadResult::ReadError;
+
+        fileBuffer = std::make_unique_for_overwrite<uint8[]>(fileSize);
+        if (!fileStream.read(reinterpret_cast<char*>(fileBuffer.get()), fileSize))
+            return TerrainMapDataReadResult::ReadError;
+
+        fileData = fileBuffer.get();
+    }
+
+    FileReader reader(fileData, fileSize);
 
     // Read the map header
     map_fileheader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    if (!reader.Read(&header, sizeof(header)))
         return TerrainMapDataReadResult::ReadError;
 
     // Check for valid map and version magics
@@ -36,30 +103,60 @@ TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
         return TerrainMapDataReadResult::InvalidMagic;
 
     // Load area data
-    if (header.areaMapOffset && !LoadAreaData(fileStream, header.areaMapOffset))
+    if (header.areaMapOffset && !LoadAreaData(reader, header.areaMapOffset))
         return TerrainMapDataReadResult::InvalidAreaData;
 
     // Load height data
-    if (header.heightMapOffset && !LoadHeightData(fileStream, header.heightMapOffset))
+    if (header.heightMapOffset && !LoadHeightData(reader, header.heightMapOffset))
         return TerrainMapDataReadResult::InvalidHeightData;
 
     // Load liquid data
-    if (header.liquidMapOffset && !LoadLiquidData(fileStream, header.liquidMapOffset))
+    if (header.liquidMapOffset && !LoadLiquidData(reader, header.liquidMapOffset))
         return TerrainMapDataReadResult::InvalidLiquidData;
 
     // Load hole data
-    if (header.holesSize && !LoadHolesData(fileStream, header.holesOffset))
+    if (header.holesSize && !LoadHolesData(reader, header.holesOffset))
         return TerrainMapDataReadResult::InvalidHoleData;
 
+    // Everything else was copied out already, keep only the heights instead of the whole file
+    if (fileBuffer)
+        CopyHeightData();
+
     return TerrainMapDataReadResult::Success;
 }
 
-bool GridTerrainData::LoadAreaData(std::ifstream& fileStream, uint32 const offset)
+void GridTerrainData::CopyHeightData()
+{
+    if (!_loadedHeightData)
+        return;
+
+    auto copy = [this](auto& heightData)
+    {
+        if (!heightData)
+            return;
+
+        std::size_t const v9Size = heightData->v9.size_bytes();
+        std::size_t const v8Size = heightData->v8.size_bytes();
+        _heightBuffer = std::make_unique_for_overwrite<uint8[]>(v9Size + v8Size);
+        memcpy(_heightBuffer.get(), heightData->v9.data(), v9Size);
+        memcpy(_heightBuffer.get() + v9Size, heightData->v8.data(), v8Size);
+
+        using Element = typename std::remove_reference_t<decltype(heightData->v9)>::element_type;
+        heightData->v9 = { reinterpret_cast<Element const*>(_heightBuffer.get()), heightData->v9.size() };
+        heightData->v8 = { reinterpret_cast<Element const*>(_heightBuffer.get() + v9Size), heightData->v8.size() };
+    };
+
+    copy(_loadedHeightData->uint16HeightData);
+    copy(_loadedHeightData->uint8HeightData);
+    copy(_loadedHeightData->floatHeightData);
+}
+
+bool GridTerrainData::LoadAreaData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_areaHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapAreaMagic.asUInt)
+    if (!reader.Read(&header, sizeof(header)) || header.fourcc != MapAreaMagic.asUInt)
         return false;
 
     _loadedAreaData = std::make_unique<LoadedAreaData>();
@@ -67,18 +164,18 @@ bool GridTerrainData::LoadAreaData(std::ifstream& fileStream, uint32 const offse
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
         _loadedAreaData->areaMap = std::make_unique<LoadedAreaData::AreaMapType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedAreaData->areaMap.get()), sizeof(LoadedAreaData::AreaMapType)))
+        if (!reader.Read(_loadedAreaData->areaMap.get(), sizeof(LoadedAreaData::AreaMapType)))
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHeightData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_heightHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapHeightMagic.asUInt)
+    if (!reader.Read(&header, sizeof(header)) || header.fourcc != MapHeightMagic.asUInt)
         return false;
 
     _loadedHeightData = std::make_unique<LoadedHeightData>();
@@ -88,8 +185,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
             _loadedHeightData->uint16HeightData = std::make_unique<LoadedHeightData::Uint16HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v9), sizeof(_loadedHeightData->uint16HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v8), sizeof(_loadedHeightData->uint16HeightData->v8)))
+            _loadedHeightData->uint16HeightData->v9 = reader.View<uint16>(129 * 129);
+            _loadedHeightData->uint16HeightData->v8 = reader.View<uint16>(128 * 128);
+            if (_loadedHeightData->uint16HeightData->v9.empty() || _loadedHeightData->uint16HeightData->v8.empty())
                 return false;
 
             _loadedHeightData->uint16HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
@@ -98,8 +196,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
             _loadedHeightData->uint8HeightData = std::make_unique<LoadedHeightData::Uint8HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v9), sizeof(_loadedHeightData->uint8HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v8), sizeof(_loadedHeightData->uint8HeightData->v8)))
+            _loadedHeightData->uint8HeightData->v9 = reader.View<uint8>(129 * 129);
+            _loadedHeightData->uint8HeightData->v8 = reader.View<uint8>(128 * 128);
+            if (_loadedHeightData->uint8HeightData->v9.empty() || _loadedHeightData->uint8HeightData->v8.empty())
                 return false;
 
             _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
@@ -108,8 +207,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         else
         {
             _loadedHeightData->floatHeightData = std::make_unique<LoadedHeightData::FloatHeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v9), sizeof(_loadedHeightData->floatHeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v8), sizeof(_loadedHeightData->floatHeightData->v8)))
+            _loadedHeightData->floatHeightData->v9 = reader.View<float>(129 * 129);
+            _loadedHeightData->floatHeightData->v8 = reader.View<float>(128 * 128);
+            if (_loadedHeightData->floatHeightData->v9.empty() || _loadedHeightData->floatHeightData->v8.empty())
                 return false;
 
             _gridGetHeight = &GridTerrainData::getHeightFromFloat;
@@ -122,8 +222,8 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (!fileStream.read(reinterpret_cast<char*>(maxHeights.data()), sizeof(maxHeights)) ||
-            !fileStream.read(reinterpret_cast<char*>(minHeights.data()), sizeof(minHeights)))
+        if (!reader.Read(maxHeights.data(), sizeof(maxHeights)) ||
+            !reader.Read(minHeights.data(), sizeof(minHeights)))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -163,12 +263,12 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     return true;
 }
 
-bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadLiquidData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_liquidHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapLiquidMagic.asUInt)
+    if (!reader.Read(&header, sizeof(header)) || header.fourcc != MapLiquidMagic.asUInt)
         return false;
 
     _loadedLiquidData = std::make_unique<LoadedLiquidData>();
@@ -183,29 +283,29 @@ bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const off
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
         _loadedLiquidData->liquidEntry = std::make_unique<LoadedLiquidData::LiquidEntryType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidEntry.get()), sizeof(LoadedLiquidData::LiquidEntryType)))
+        if (!reader.Read(_loadedLiquidData->liquidEntry.get(), sizeof(LoadedLiquidData::LiquidEntryType)))
             return false;
 
         _loadedLiquidData->liquidFlags = std::make_unique<LoadedLiquidData::LiquidFlagsType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidFlags.get()), sizeof(LoadedLiquidData::LiquidFlagsType)))
+        if (!reader.Read(_loadedLiquidData->liquidFlags.get(), sizeof(LoadedLiquidData::LiquidFlagsType)))
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
         _loadedLiquidData->liquidMap = std::make_unique<LoadedLiquidData::LiquidMapType>();
         _loadedLiquidData->liquidMap->resize(_loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidMap->data()), _loadedLiquidData->liquidMap->size() * sizeof(float)))
+        if (!reader.Read(_loadedLiquidData->liquidMap->data(), _loadedLiquidData->liquidMap->size() * sizeof(float)))
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHolesData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHolesData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     _loadedHoleData = std::make_unique<LoadedHoleData>();
-    if (!fileStream.read(reinterpret_cast<char*>(&_loadedHoleData->holes), sizeof(_loadedHoleData->holes)))
+    if (!reader.Read(&_loadedHoleData->holes, sizeof(_loadedHoleData->holes)))
         return false;
 
     return true;
@@ -338,7 +438,7 @@ float GridTerrainData::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -408,7 +508,7 @@ float GridTerrainData::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -19,9 +19,11 @@
 #define GRID_TERRAIN_DATA_H
 
 #include "Common.h"
-#include <fstream>
+#include "MappedFile.h"
 #include <G3D/Plane.h>
+#include <array>
 #include <memory>
+#include <span>
 
 #define MAX_HEIGHT            100000.0f                     // can be use for find ground height at surface
 #define INVALID_HEIGHT       -100000.0f                     // for check, must be equal to VMAP_INVALID_HEIGHT, real value for unknown height is VMAP_INVALID_HEIGHT_VALUE
@@ -121,14 +123,16 @@ struct LoadedAreaData
     std::unique_ptr<AreaMapType> areaMap;
 };
 
+// Height grids are the bulk of a map file, they point straight into the file contents
+// owned by GridTerrainData instead of being copied out of them
 struct LoadedHeightData
 {
     typedef std::array<G3D::Plane, 8> HeightPlanesType;
 
     struct Uint16HeightData
     {
-        typedef std::array<uint16, 129 * 129> V9Type;
-        typedef std::array<uint16, 128 * 128> V8Type;
+        typedef std::span<uint16 const> V9Type;
+        typedef std::span<uint16 const> V8Type;
 
         V9Type v9;
         V8Type v8;
@@ -137,8 +141,8 @@ struct LoadedHeightData
 
     struct Uint8HeightData
     {
-        typedef std::array<uint8, 129 * 129> V9Type;
-        typedef std::array<uint8, 128 * 128> V8Type;
+        typedef std::span<uint8 const> V9Type;
+        typedef std::span<uint8 const> V8Type;
 
         V9Type v9;
         V8Type v8;
@@ -147,8 +151,8 @@ struct LoadedHeightData
 
     struct FloatHeightData
     {
-        typedef std::array<float, 129 * 129> V9Type;
-        typedef std::array<float, 128 * 128> V8Type;
+        typedef std::span<float const> V9Type;
+        typedef std::span<float const> V8Type;
 
         V9Type v9;
         V8Type v8;
@@ -220,10 +224,18 @@ enum class TerrainMapDataReadResult
 
 class GridTerrainData
 {
-    bool LoadAreaData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHeightData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadLiquidData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHolesData(std::ifstream& fileStream, uint32 const offset);
+    class FileReader;
+
+    bool LoadAreaData(FileReader& reader, uint32 const offset);
+    bool LoadHeightData(FileReader& reader, uint32 const offset);
+    bool LoadLiquidData(FileReader& reader, uint32 const offset);
+    bool LoadHolesData(FileReader& reader, uint32 const offset);
+    void CopyHeightData();
+
+    // Memory backing the height views, either the file mapped from the page cache
+    // or a copy of just the height arrays
+    std::unique_ptr<Acore::MappedFile> _mappedFile;
+    std::unique_ptr<uint8[]> _heightBuffer;
 
     std::unique_ptr<LoadedAreaData> _loadedAreaData;
     std::unique_ptr<LoadedHeightData> _loadedHeightData;
@@ -243,7 +255,7 @@ class GridTerrainData
 public:
     GridTerrainData();
     ~GridTerrainData() { };
-    TerrainMapDataReadResult Load(std::string const& mapFileName);
+    TerrainMapDataReadResult Load(std::string const& mapFileName, bool memoryMapped = false);
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
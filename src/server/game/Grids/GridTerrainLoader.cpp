@@ -1,10 +1,12 @@
 #include "DisableMgr.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPreloader.h"
 #include "MMapFactory.h"
 #include "MMapMgr.h"
 #include "ScriptMgr.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
+#include <fstream>
 
 void GridTerrainLoader::LoadTerrain()
 {
@@ -32,10 +34,15 @@ void GridTerrainLoader::LoadMap()
     // map file name
     std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
 
-    // loading data
-    LOG_DEBUG("maps", "Loading map {}", mapFileName);
-    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
-    TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
+    // loading data, unless a preloader thread already did it for us
+    std::unique_ptr<GridTerrainData> terrainData;
+    TerrainMapDataReadResult loadResult;
+    if (!sGridTerrainPreloader->Take(_map->GetId(), _grid.GetX(), _grid.GetY(), terrainData, loadResult))
+    {
+        LOG_DEBUG("maps", "Loading map {}", mapFileName);
+        terrainData = std::make_unique<GridTerrainData>();
+        loadResult = terrainData->Load(mapFileName, sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_DATA));
+    }
     if (loadResult == TerrainMapDataReadResult::Success)
         _grid.SetTerrainData(std::move(terrainData));
     else
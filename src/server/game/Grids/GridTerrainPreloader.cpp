@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainPreloader.h"
+#include "Log.h"
+#include "MapTree.h"
+#include "StringFormat.h"
+#include "World.h"
+#include <cstdio>
+#include <limits>
+
+namespace
+{
+    // Reads a whole file and throws the contents away so it is resident in the page cache
+    void WarmFile(std::string const& fileName)
+    {
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (!file)
+            return;
+
+        char buffer[64 * 1024];
+        while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer))
+            ;
+
+        fclose(file);
+    }
+}
+
+GridTerrainPreloader* GridTerrainPreloader::instance()
+{
+    static GridTerrainPreloader instance;
+    return &instance;
+}
+
+void GridTerrainPreloader::Initialize(std::size_t numThreads, std::size_t maxCachedGrids)
+{
+    if (!numThreads || !maxCachedGrids)
+        return;
+
+    _dataPath = sWorld->GetDataPath();
+    _warmMMaps = sWorld->getBoolConfig(CONFIG_ENABLE_MMAPS);
+    _memoryMapped = sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_DATA);
+    _maxCachedGrids = maxCachedGrids;
+    _cancelationToken = false;
+
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&GridTerrainPreloader::WorkerThread, this));
+
+    LOG_INFO("server.loading", "Grid terrain preloader started with {} thread(s), keeping up to {} grid(s) ready", numThreads, maxCachedGrids);
+}
+
+void GridTerrainPreloader::Shutdown()
+{
+    if (!IsEnabled())
+        return;
+
+    _cancelationToken = true;
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _pending.clear();
+    _ready.clear();
+    _readyOrder.clear();
+}
+
+void GridTerrainPreloader::Request(uint32 mapId, uint16 x, uint16 y)
+{
+    if (!IsEnabled())
+        return;
+
+    uint64 const key = MakeKey(mapId, x, y);
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_ready.contains(key) || !_pending.insert(key).second)
+            return;
+    }
+
+    _queue.Push(key);
+}
+
+bool GridTerrainPreloader::Take(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& loadResult)
+{
+    if (!IsEnabled())
+        return false;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _ready.find(MakeKey(mapId, x, y));
+    if (itr == _ready.end())
+        return false;
+
+    terrainData = std::move(itr->second.Data);
+    loadResult = itr->second.Result;
+    _readyOrder.erase(itr->second.OrderItr);
+    _ready.erase(itr);
+    return true;
+}
+
+void GridTerrainPreloader::WorkerThread()
+{
+    while (!_cancelationToken)
+    {
+        uint64 key = std::numeric_limits<uint64>::max();
+        _queue.WaitAndPop(key);
+
+        if (!_cancelationToken && key != std::numeric_limits<uint64>::max())
+            Preload(key);
+    }
+}
+
+void GridTerrainPreloader::Preload(uint64 key)
+{
+    uint32 const mapId = uint32(key >> 32);
+    uint16 const x = uint16(key >> 16);
+    uint16 const y = uint16(key);
+
+    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", _dataPath, mapId, x, y);
+
+    PreloadedTerrain preloaded;
+    preloaded.Data = std::make_unique<GridTerrainData>();
+    preloaded.Result = preloaded.Data->Load(mapFileName, _memoryMapped);
+    if (preloaded.Result != TerrainMapDataReadResult::Success)
+        preloaded.Data.reset();
+
+    WarmFile(_dataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(mapId, x, y));
+    if (_warmMMaps)
+        WarmFile(Acore::StringFormat("{}mmaps/{:03}{:02}{:02}.mmtile", _dataPath, mapId, x, y));
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _pending.erase(key);
+
+    preloaded.OrderItr = _readyOrder.insert(_readyOrder.end(), key);
+    _ready[key] = std::move(preloaded);
+
+    // Drop the oldest grids nobody entered, the player most likely turned around
+    while (_ready.size() > _maxCachedGrids)
+    {
+        _ready.erase(_readyOrder.front());
+        _readyOrder.pop_front();
+    }
+}
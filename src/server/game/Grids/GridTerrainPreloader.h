@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_PRELOADER_H
+#define ACORE_GRID_TERRAIN_PRELOADER_H
+
+#include "Define.h"
+#include "GridTerrainData.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Loads terrain for grids that players are about to enter on background threads.
+// The .map file is fully parsed off the map thread and handed over to GridTerrainLoader
+// when the grid is created. VMap and MMap tiles are owned by managers that may only be
+// mutated from the map thread, so for those the worker only reads the tile files to
+// warm the OS page cache; the later synchronous load then no longer touches the disk.
+class GridTerrainPreloader
+{
+public:
+    static GridTerrainPreloader* instance();
+
+    void Initialize(std::size_t numThreads, std::size_t maxCachedGrids);
+    void Shutdown();
+
+    [[nodiscard]] bool IsEnabled() const { return !_workerThreads.empty(); }
+
+    // Queues a grid for preloading, does nothing if it is already queued or cached
+    void Request(uint32 mapId, uint16 x, uint16 y);
+
+    // Hands over preloaded terrain data for a grid, returns false if none is ready
+    bool Take(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& loadResult);
+
+private:
+    GridTerrainPreloader() = default;
+    ~GridTerrainPreloader() = default;
+
+    struct PreloadedTerrain
+    {
+        std::unique_ptr<GridTerrainData> Data;
+        TerrainMapDataReadResult Result;
+        std::list<uint64>::iterator OrderItr;
+    };
+
+    static uint64 MakeKey(uint32 mapId, uint16 x, uint16 y) { return (uint64(mapId) << 32) | (uint32(x) << 16) | y; }
+
+    void WorkerThread();
+    void Preload(uint64 key);
+
+    ProducerConsumerQueue<uint64> _queue;
+    std::atomic<bool> _cancelationToken{};
+    std::vector<std::thread> _workerThreads;
+
+    std::mutex _lock;
+    std::unordered_set<uint64> _pending;
+    std::unordered_map<uint64, PreloadedTerrain> _ready;
+    std::list<uint64> _readyOrder;
+    std::size_t _maxCachedGrids = 0;
+
+    std::string _dataPath;
+    bool _warmMMaps = false;
+    bool _memoryMapped = false;
+};
+
+#define sGridTerrainPreloader GridTerrainPreloader::instance()
+
+#endif
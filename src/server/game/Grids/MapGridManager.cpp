@@ -2,11 +2,18 @@
 #include "GridObjectLoader.h"
 #include "GridTerrainLoader.h"
 
-void MapGridManager::CreateGrid(uint16 const x, uint16 const y)
+MapGridManager::~MapGridManager()
+{
+    for (uint32 gridX = 0; gridX < MAX_NUMBER_OF_GRIDS; ++gridX)
+        for (uint32 gridY = 0; gridY < MAX_NUMBER_OF_GRIDS; ++gridY)
+            delete _mapGrid[gridX][gridY].load(std::memory_order_relaxed);
+}
+
+bool MapGridManager::CreateGrid(uint16 const x, uint16 const y)
 {
     std::lock_guard<std::mutex> guard(_gridLock);
     if (IsGridCreated(x, y))
-        return;
+        return false;
 
     std::unique_ptr<MapGridType> grid = std::make_unique<MapGridType>(x, y);
     grid->link(_map);
@@ -14,9 +21,10 @@ void MapGridManager::CreateGrid(uint16 const x, uint16 const y)
     GridTerrainLoader loader(*grid, _map);
     loader.LoadTerrain();
 
-    _mapGrid[x][y] = std::move(grid);
+    _mapGrid[x][y].store(grid.release(), std::memory_order_release);
 
     ++_createdGridsCount;
+    return true;
 }
 
 bool MapGridManager::LoadGrid(uint16 const x, uint16 const y)
@@ -58,7 +66,7 @@ void MapGridManager::UnloadGrid(uint16 const x, uint16 const y)
     GridTerrainUnloader terrainUnloader(*grid, _map);
     terrainUnloader.UnloadTerrain();
 
-    _mapGrid[x][y] = nullptr;
+    delete _mapGrid[x][y].exchange(nullptr, std::memory_order_acq_rel);
 }
 
 bool MapGridManager::IsGridCreated(uint16 const x, uint16 const y) const
@@ -66,7 +74,7 @@ bool MapGridManager::IsGridCreated(uint16 const x, uint16 const y) const
     if (!MapGridManager::IsValidGridCoordinates(x, y))
         return false;
 
-    return _mapGrid[x][y].get();
+    return _mapGrid[x][y].load(std::memory_order_acquire);
 }
 
 bool MapGridManager::IsGridLoaded(uint16 const x, uint16 const y) const
@@ -74,7 +82,8 @@ bool MapGridManager::IsGridLoaded(uint16 const x, uint16 const y) const
     if (!MapGridManager::IsValidGridCoordinates(x, y))
         return false;
 
-    return _mapGrid[x][y].get() && _mapGrid[x][y]->IsObjectDataLoaded();
+    MapGridType const* grid = _mapGrid[x][y].load(std::memory_order_acquire);
+    return grid && grid->IsObjectDataLoaded();
 }
 
 MapGridType* MapGridManager::GetGrid(uint16 const x, uint16 const y)
@@ -82,7 +91,7 @@ MapGridType* MapGridManager::GetGrid(uint16 const x, uint16 const y)
     if (!MapGridManager::IsValidGridCoordinates(x, y))
         return nullptr;
 
-    return _mapGrid[x][y].get();
+    return _mapGrid[x][y].load(std::memory_order_acquire);
 }
 
 uint32 MapGridManager::GetCreatedGridsCount()
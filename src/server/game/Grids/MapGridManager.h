@@ -23,6 +23,7 @@
 #include "MapDefines.h"
 #include "MapGrid.h"
 
+#include <atomic>
 #include <mutex>
 
 class Map;
@@ -31,8 +32,13 @@ class MapGridManager
 {
 public:
     MapGridManager(Map* map) : _map(map), _createdGridsCount(0), _loadedGridsCount(0) { }
+    ~MapGridManager();
 
-    void CreateGrid(uint16 const x, uint16 const y);
+    MapGridManager(MapGridManager const&) = delete;
+    MapGridManager& operator=(MapGridManager const&) = delete;
+
+    // Returns false if the grid already existed
+    bool CreateGrid(uint16 const x, uint16 const y);
     bool LoadGrid(uint16 const x, uint16 const y);
     void UnloadGrid(uint16 const x, uint16 const y);
     bool IsGridCreated(uint16 const x, uint16 const y) const;
@@ -55,8 +61,10 @@ private:
     uint32 _createdGridsCount;
     uint32 _loadedGridsCount;
 
+    // Grids are created under _gridLock, also from preload and pathfinding threads,
+    // the slots are atomic so checking for a grid does not need the lock
     std::mutex _gridLock;
-    std::unique_ptr<MapGridType> _mapGrid[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+    std::atomic<MapGridType*> _mapGrid[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS] = {};
 };
 
 #endif
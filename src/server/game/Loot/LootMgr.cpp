@@ -27,6 +27,7 @@
 #include "SharedDefines.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
+#include "TaskGraph.h"
 #include "Util.h"
 #include "World.h"
 
@@ -2371,3 +2372,33 @@ void LoadLootTemplates_Reference()
     LOG_INFO("server.loading", ">> Loaded reference loot templates in {} ms", GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
+
+void AddLootTableLoaders(Acore::TaskGraph& graph)
+{
+    std::vector<Acore::TaskGraph::TaskId> tables;
+    tables.push_back(graph.AddTask("creature_loot_template", LoadLootTemplates_Creature));
+    tables.push_back(graph.AddTask("fishing_loot_template", LoadLootTemplates_Fishing));
+    tables.push_back(graph.AddTask("gameobject_loot_template", LoadLootTemplates_Gameobject));
+    tables.push_back(graph.AddTask("item_loot_template", LoadLootTemplates_Item));
+    tables.push_back(graph.AddTask("mail_loot_template", LoadLootTemplates_Mail));
+    tables.push_back(graph.AddTask("milling_loot_template", LoadLootTemplates_Milling));
+    tables.push_back(graph.AddTask("pickpocketing_loot_template", LoadLootTemplates_Pickpocketing));
+    tables.push_back(graph.AddTask("skinning_loot_template", LoadLootTemplates_Skinning));
+    tables.push_back(graph.AddTask("disenchant_loot_template", LoadLootTemplates_Disenchant));
+    tables.push_back(graph.AddTask("prospecting_loot_template", LoadLootTemplates_Prospecting));
+    tables.push_back(graph.AddTask("spell_loot_template", LoadLootTemplates_Spell));
+
+    // CheckLootRefs walks all other tables, so the reference table waits for every one of them
+    Acore::TaskGraph::TaskId reference = graph.AddTask("reference_loot_template", LoadLootTemplates_Reference);
+    for (Acore::TaskGraph::TaskId table : tables)
+        graph.AddDependency(reference, table);
+
+    graph.AddTask("player_loot_template", LoadLootTemplates_Player);
+}
+
+void LoadLootTables()
+{
+    Acore::TaskGraph graph;
+    AddLootTableLoaders(graph);
+    graph.Run(1);
+}
@@ -440,23 +440,14 @@ void LoadLootTemplates_Reference();
 
 void LoadLootTemplates_Player();
 
-inline void LoadLootTables()
+namespace Acore
 {
-    LoadLootTemplates_Creature();
-    LoadLootTemplates_Fishing();
-    LoadLootTemplates_Gameobject();
-    LoadLootTemplates_Item();
-    LoadLootTemplates_Mail();
-    LoadLootTemplates_Milling();
-    LoadLootTemplates_Pickpocketing();
-    LoadLootTemplates_Skinning();
-    LoadLootTemplates_Disenchant();
-    LoadLootTemplates_Prospecting();
-    LoadLootTemplates_Spell();
-
-    LoadLootTemplates_Reference();
-
-    LoadLootTemplates_Player();
+    class TaskGraph;
 }
 
+// Adds one task per loot table, the reference table is checked against the others once they are loaded
+void AddLootTableLoaders(Acore::TaskGraph& graph);
+
+void LoadLootTables();
+
 #endif
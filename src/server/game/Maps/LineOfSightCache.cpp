@@ -0,0 +1,77 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include <bit>
+
+void LineOfSightCache::SetCapacity(uint32 capacity)
+{
+    _entries.clear();
+    if (capacity)
+        _entries.resize(std::bit_ceil(capacity));
+}
+
+std::array<uint32, 6> LineOfSightCache::MakePoints(float x1, float y1, float z1, float x2, float y2, float z2)
+{
+    return { std::bit_cast<uint32>(x1), std::bit_cast<uint32>(y1), std::bit_cast<uint32>(z1),
+        std::bit_cast<uint32>(x2), std::bit_cast<uint32>(y2), std::bit_cast<uint32>(z2) };
+}
+
+LineOfSightCache::Entry& LineOfSightCache::GetSlot(std::array<uint32, 6> const& points, uint32 ignoreFlags)
+{
+    // FNV-1a over the raw coordinates
+    uint32 hash = 2166136261u;
+    for (uint32 point : points)
+        hash = (hash ^ point) * 16777619u;
+    hash = (hash ^ ignoreFlags) * 16777619u;
+
+    return _entries[(hash ^ (hash >> 16)) & (_entries.size() - 1)];
+}
+
+bool LineOfSightCache::Find(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, uint32 tileGeneration, bool& inLineOfSight)
+{
+    std::array<uint32, 6> const points = MakePoints(x1, y1, z1, x2, y2, z2);
+    Entry const& entry = GetSlot(points, ignoreFlags);
+    if (!entry.Used || entry.TileGeneration != tileGeneration || entry.IgnoreFlags != ignoreFlags || entry.Points != points)
+    {
+        ++_misses;
+        return false;
+    }
+
+    inLineOfSight = entry.InLineOfSight;
+    ++_hits;
+    return true;
+}
+
+void LineOfSightCache::Store(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, uint32 tileGeneration, bool inLineOfSight)
+{
+    std::array<uint32, 6> const points = MakePoints(x1, y1, z1, x2, y2, z2);
+    Entry& entry = GetSlot(points, ignoreFlags);
+    entry.Points = points;
+    entry.IgnoreFlags = ignoreFlags;
+    entry.TileGeneration = tileGeneration;
+    entry.InLineOfSight = inLineOfSight;
+    entry.Used = true;
+}
+
+void LineOfSightCache::ConsumeStats(uint32& hits, uint32& misses)
+{
+    hits = _hits;
+    misses = _misses;
+    _hits = 0;
+    _misses = 0;
+}
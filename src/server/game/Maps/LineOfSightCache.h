@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_LINE_OF_SIGHT_CACHE_H
+#define ACORE_LINE_OF_SIGHT_CACHE_H
+
+#include "Define.h"
+#include <array>
+#include <vector>
+
+// Remembers line of sight results against static map geometry (vmaps) for one map.
+// Direct mapped: every segment has exactly one slot and a newer segment simply replaces it.
+// Segments are compared by their exact coordinates, standing casters and mobs repeat the same
+// queries every update while anything that moves never matches and only costs a slot.
+// Results are bound to the tile generation of the vmap tree they were computed on.
+class LineOfSightCache
+{
+public:
+    LineOfSightCache() = default;
+
+    // Rounded up to a power of two, 0 disables the cache
+    void SetCapacity(uint32 capacity);
+    [[nodiscard]] bool IsEnabled() const { return !_entries.empty(); }
+
+    bool Find(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, uint32 tileGeneration, bool& inLineOfSight);
+    void Store(float x1, float y1, float z1, float x2, float y2, float z2, uint32 ignoreFlags, uint32 tileGeneration, bool inLineOfSight);
+
+    // Lookups since the last call
+    void ConsumeStats(uint32& hits, uint32& misses);
+
+private:
+    struct Entry
+    {
+        std::array<uint32, 6> Points{};
+        uint32 IgnoreFlags = 0;
+        uint32 TileGeneration = 0;
+        bool InLineOfSight = false;
+        bool Used = false;
+    };
+
+    static std::array<uint32, 6> MakePoints(float x1, float y1, float z1, float x2, float y2, float z2);
+    Entry& GetSlot(std::array<uint32, 6> const& points, uint32 ignoreFlags);
+
+    std::vector<Entry> _entries;
+    uint32 _hits = 0;
+    uint32 _misses = 0;
+};
+
+#endif
@@ -24,6 +24,7 @@
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
+#include "GridTerrainPreloader.h"
 #include "Group.h"
 #include "InstanceScript.h"
 #include "IVMapMgr.h"
@@ -33,10 +34,14 @@
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
+#include "MoveSpline.h"
 #include "Object.h"
+#include "PathGenerator.h"
+#include "PathfindingService.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
 #include "VMapFactory.h"
@@ -75,12 +80,19 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _mapGridManager(this), i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+    _gridLoadStallTime(0), _gridLoadCount(0)
 {
     m_parentMap = (_parent ? _parent : this);
 
     _zonePlayerCountMap.clear();
     _updatableObjectListRecheckTimer.SetInterval(UPDATABLE_OBJECT_LIST_RECHECK_TIMER);
+    _gridPreloadTimer.SetInterval(GRID_PRELOAD_TIMER);
+
+    if (sWorld->getBoolConfig(CONFIG_ENABLE_MMAPS))
+        _pathCache.SetCapacity(sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE));
+
+    _lineOfSightCache.SetCapacity(sWorld->getIntConfig(CONFIG_VMAP_LOS_CACHE_SIZE));
 
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
@@ -193,15 +205,27 @@ void Map::DeleteFromWorld(Player* player)
 
 void Map::EnsureGridCreated(GridCoord const& gridCoord)
 {
-    _mapGridManager.CreateGrid(gridCoord.x_coord, gridCoord.y_coord);
+    if (IsGridCreated(gridCoord))
+        return;
+
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    if (_mapGridManager.CreateGrid(gridCoord.x_coord, gridCoord.y_coord))
+        _gridLoadStallTime.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
 }
 
 bool Map::EnsureGridLoaded(Cell const& cell)
 {
-    EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
+    GridCoord const gridCoord(cell.GridX(), cell.GridY());
+    if (IsGridLoaded(gridCoord))
+        return false;
+
+    EnsureGridCreated(gridCoord);
 
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
     if (_mapGridManager.LoadGrid(cell.GridX(), cell.GridY()))
     {
+        _gridLoadStallTime.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+        _gridLoadCount.fetch_add(1, std::memory_order_relaxed);
         Balance();
         return true;
     }
@@ -456,6 +480,8 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    ACORE_PROFILE_SCOPE("Map {}", GetId());
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
@@ -485,6 +511,7 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     }
 
     _updatableObjectListRecheckTimer.Update(t_diff);
+    _gridPreloadTimer.Update(t_diff);
     resetMarkedCells();
 
     // Update players
@@ -497,6 +524,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
         player->Update(s_diff);
 
+        if (_gridPreloadTimer.Passed())
+            PreloadGridsAhead(player);
+
         if (_updatableObjectListRecheckTimer.Passed())
         {
             MarkNearbyCellsOf(player);
@@ -512,6 +542,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    if (_gridPreloadTimer.Passed())
+        _gridPreloadTimer.Reset();
+
     if (_updatableObjectListRecheckTimer.Passed())
     {
         // Mark all cells near active objects
@@ -541,10 +574,15 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     MoveAllGameObjectsInMoveList();
     MoveAllDynamicObjectsInMoveList();
 
+    ProcessPathRequests();
+
     HandleDelayedVisibility();
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    uint64 const gridLoadStallTime = _gridLoadStallTime.exchange(0, std::memory_order_relaxed);
+    uint64 const gridLoadCount = _gridLoadCount.exchange(0, std::memory_order_relaxed);
+
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -552,6 +590,116 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_grid_load_stall", gridLoadStallTime,
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_grid_loads", gridLoadCount,
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_pathCache.IsEnabled())
+    {
+        uint32 pathCacheHits, pathCacheMisses;
+        _pathCache.ConsumeStats(pathCacheHits, pathCacheMisses);
+
+        METRIC_VALUE("map_path_cache_hits", uint64(pathCacheHits),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_path_cache_misses", uint64(pathCacheMisses),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    if (_lineOfSightCache.IsEnabled())
+    {
+        uint32 losCacheHits, losCacheMisses;
+        _lineOfSightCache.ConsumeStats(losCacheHits, losCacheMisses);
+
+        METRIC_VALUE("map_los_cache_hits", uint64(losCacheHits),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_los_cache_misses", uint64(losCacheMisses),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    if (gridLoadStallTime >= GRID_LOAD_STALL_WARN_TIME)
+        LOG_DEBUG("maps", "Map {} (instance {}) stalled {} ms loading {} grid(s)", GetId(), GetInstanceId(), gridLoadStallTime / 1000, gridLoadCount);
+}
+
+void Map::ProcessPathRequests()
+{
+    // generators that were reset since queueing their request no longer want it
+    std::erase_if(_pathRequests, [](std::shared_ptr<PathGenerator> const& path) { return !path->IsPathPending(); });
+    if (_pathRequests.empty())
+        return;
+
+    METRIC_VALUE("map_async_paths", uint64(_pathRequests.size()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    // create the grids at both ends up front, the workers are not allowed to load them
+    auto createGrid = [this](float x, float y)
+    {
+        GridCoord const gridCoord = Acore::ComputeGridCoord(x, y);
+        if (gridCoord.IsCoordValid())
+            EnsureGridCreated(gridCoord);
+    };
+
+    for (std::shared_ptr<PathGenerator> const& path : _pathRequests)
+    {
+        G3D::Vector3 const& dest = path->GetAsyncDestination();
+        createGrid(path->GetSource()->GetPositionX(), path->GetSource()->GetPositionY());
+        createGrid(dest.x, dest.y);
+    }
+
+    sPathfindingService->CalculatePaths(_pathRequests);
+    _pathRequests.clear();
+}
+
+void Map::PreloadGridsAhead(Player* player)
+{
+    if (!sGridTerrainPreloader->IsEnabled() || _mapGridManager.IsGridsFullyLoaded())
+        return;
+
+    GridCoord lastRequested(MAX_NUMBER_OF_GRIDS, MAX_NUMBER_OF_GRIDS);
+    auto requestAt = [this, &lastRequested](float x, float y)
+    {
+        GridCoord const gridCoord = Acore::ComputeGridCoord(x, y);
+        if (gridCoord == lastRequested || !gridCoord.IsCoordValid() || IsGridCreated(gridCoord))
+            return;
+
+        lastRequested = gridCoord;
+        sGridTerrainPreloader->Request(GetId(), gridCoord.x_coord, gridCoord.y_coord);
+    };
+
+    // Taxi flights follow a known spline, walk it ahead of the player
+    if (player->IsInFlight() && player->movespline->Initialized() && !player->movespline->Finalized())
+    {
+        Movement::MoveSpline::MySpline const& spline = player->movespline->_Spline();
+        float remaining = GRID_PRELOAD_SPLINE_DISTANCE;
+        for (int32 i = player->movespline->_currentSplineIdx() + 1; i <= spline.last() && remaining > 0.0f; ++i)
+        {
+            G3D::Vector3 const& point = spline.getPoint(i);
+            remaining -= (point - spline.getPoint(i - 1)).length();
+            requestAt(point.x, point.y);
+        }
+        return;
+    }
+
+    if (!player->isMoving())
+        return;
+
+    // Otherwise extrapolate along the facing direction, past the edge of the visible area
+    float const speed = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN);
+    float const distance = std::min(GetVisibilityRange() + speed * GRID_PRELOAD_LOOKAHEAD_TIME, SIZE_OF_GRIDS);
+    float const orientation = player->GetOrientation();
+    for (float step : { 0.5f, 1.0f })
+        requestAt(player->GetPositionX() + distance * step * std::cos(orientation), player->GetPositionY() + distance * step * std::sin(orientation));
 }
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
@@ -1517,7 +1665,7 @@ float Map::GetWaterLevel(float x, float y) const
     return INVALID_HEIGHT;
 }
 
-bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+VMAP::ModelIgnoreFlags Map::GetStaticLineOfSightIgnoreFlags(VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS))
     {
@@ -1535,9 +1683,30 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
         }
     }
 
-    if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
+    return ignoreFlags;
+}
+
+bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    ignoreFlags = GetStaticLineOfSightIgnoreFlags(ignoreFlags);
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
     {
-        return false;
+        VMAP::VMapMgr2* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
+        uint32 const tileGeneration = _lineOfSightCache.IsEnabled() ? vmgr->GetTileGeneration(GetId()) : 0;
+
+        bool inLineOfSight;
+        if (!_lineOfSightCache.IsEnabled() || !_lineOfSightCache.Find(x1, y1, z1, x2, y2, z2, uint32(ignoreFlags), tileGeneration, inLineOfSight))
+        {
+            inLineOfSight = vmgr->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+            if (_lineOfSightCache.IsEnabled())
+                _lineOfSightCache.Store(x1, y1, z1, x2, y2, z2, uint32(ignoreFlags), tileGeneration, inLineOfSight);
+        }
+
+        if (!inLineOfSight)
+        {
+            return false;
+        }
     }
 
     if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
@@ -1557,6 +1726,61 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(VMAP::LineOfSightQuery* queries, std::size_t count, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        queries[i].InLineOfSight = true;
+
+    ignoreFlags = GetStaticLineOfSightIgnoreFlags(ignoreFlags);
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        VMAP::VMapMgr2* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
+        uint32 const tileGeneration = _lineOfSightCache.IsEnabled() ? vmgr->GetTileGeneration(GetId()) : 0;
+
+        // only segments nobody asked for recently go to the map tree, all of them in one batch
+        std::vector<VMAP::LineOfSightQuery> misses;
+        std::vector<std::size_t> missIndices;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            VMAP::LineOfSightQuery& query = queries[i];
+            if (_lineOfSightCache.IsEnabled() && _lineOfSightCache.Find(query.x1, query.y1, query.z1, query.x2, query.y2, query.z2, uint32(ignoreFlags), tileGeneration, query.InLineOfSight))
+                continue;
+
+            misses.push_back(query);
+            missIndices.push_back(i);
+        }
+
+        if (!misses.empty())
+        {
+            vmgr->isInLineOfSight(GetId(), misses.data(), misses.size(), ignoreFlags);
+            for (std::size_t i = 0; i < misses.size(); ++i)
+            {
+                VMAP::LineOfSightQuery const& miss = misses[i];
+                queries[missIndices[i]].InLineOfSight = miss.InLineOfSight;
+                if (_lineOfSightCache.IsEnabled())
+                    _lineOfSightCache.Store(miss.x1, miss.y1, miss.z1, miss.x2, miss.y2, miss.z2, uint32(ignoreFlags), tileGeneration, miss.InLineOfSight);
+            }
+        }
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            VMAP::LineOfSightQuery& query = queries[i];
+            if (query.InLineOfSight && !_dynamicTree.isInLineOfSight(query.x1, query.y1, query.z1, query.x2, query.y2, query.z2, phasemask, ignoreFlags))
+                query.InLineOfSight = false;
+        }
+    }
+}
+
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -26,16 +26,20 @@
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
+#include "IVMapMgr.h"
+#include "LineOfSightCache.h"
 #include "MapGridManager.h"
 #include "MapRefMgr.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "Timer.h"
 #include "GridTerrainData.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
@@ -87,6 +91,10 @@ struct ScriptAction
 #define DEFAULT_HEIGHT_SEARCH     50.0f                     // default search distance to find height at nearby locations
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 #define UPDATABLE_OBJECT_LIST_RECHECK_TIMER 30 * IN_MILLISECONDS // Time to recheck update object list
+#define GRID_PRELOAD_TIMER    1 * IN_MILLISECONDS           // Time between predictions of the grids players are heading to
+#define GRID_PRELOAD_LOOKAHEAD_TIME 10.0f                   // Seconds of travel past the visibility range to preload grids for
+#define GRID_PRELOAD_SPLINE_DISTANCE SIZE_OF_GRIDS          // Distance along a taxi spline to preload grids for
+#define GRID_LOAD_STALL_WARN_TIME 50000                     // Microseconds spent loading grids in one update before it is logged
 
 struct PositionFullTerrainStatus
 {
@@ -184,6 +192,9 @@ public:
     template<class T> void RemoveFromMap(T*, bool);
 
     void MarkNearbyCellsOf(WorldObject* obj);
+    void QueuePathRequest(std::shared_ptr<PathGenerator> path) { _pathRequests.push_back(std::move(path)); }
+    PathCache& GetPathCache() { return _pathCache; }
+    void PreloadGridsAhead(Player* player);
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
@@ -389,6 +400,8 @@ public:
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    // Answers several line of sight checks at once, the vmap part is traced in ray packets
+    void isInLineOfSight(VMAP::LineOfSightQuery* queries, std::size_t count, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
@@ -640,6 +653,20 @@ private:
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
     IntervalTimer _updatableObjectListRecheckTimer;
+    IntervalTimer _gridPreloadTimer;
+
+    void ProcessPathRequests();
+
+    // Paths built by the pathfinding service at the end of the update
+    std::vector<std::shared_ptr<PathGenerator>> _pathRequests;
+    PathCache _pathCache;
+
+    [[nodiscard]] VMAP::ModelIgnoreFlags GetStaticLineOfSightIgnoreFlags(VMAP::ModelIgnoreFlags ignoreFlags) const;
+    mutable LineOfSightCache _lineOfSightCache;
+
+    // Time spent creating and loading grids since the last metric report, also added to by preload and pathfinding threads
+    std::atomic<uint64> _gridLoadStallTime;
+    std::atomic<uint64> _gridLoadCount;
 };
 
 enum InstanceResetMethod
@@ -20,14 +20,17 @@
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPreloader.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "LFGMgr.h"
 #include "Language.h"
 #include "Log.h"
 #include "MapInstanced.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "PathfindingService.h"
 #include "Opcodes.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -59,6 +62,11 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    sGridTerrainPreloader->Initialize(sWorld->getIntConfig(CONFIG_MAP_PRELOAD_THREADS), sWorld->getIntConfig(CONFIG_MAP_PRELOAD_MAX_GRIDS));
+
+    if (sWorld->getBoolConfig(CONFIG_ENABLE_MMAPS))
+        sPathfindingService->Initialize(sWorld->getIntConfig(CONFIG_MMAP_ASYNC_THREADS), sWorld->getFloatConfig(CONFIG_MMAP_ASYNC_MIN_DISTANCE));
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -272,7 +280,10 @@ void MapMgr::Update(uint32 diff)
         if (m_updater.activated())
             m_updater.schedule_update(*iter->second, uint32(full ? i_timer[mapUpdateStep].GetCurrent() : 0), diff);
         else
+        {
+            METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(iter->second->GetId())));
             iter->second->Update(uint32(full ? i_timer[mapUpdateStep].GetCurrent() : 0), diff);
+        }
     }
 
     if (m_updater.activated())
@@ -326,6 +337,9 @@ bool MapMgr::IsValidMAP(uint32 mapid, bool startUp)
 
 void MapMgr::UnloadAll()
 {
+    sGridTerrainPreloader->Shutdown();
+    sPathfindingService->Shutdown();
+
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end();)
     {
         iter->second->UnloadAll();
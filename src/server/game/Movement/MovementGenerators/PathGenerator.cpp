@@ -30,7 +30,8 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
     _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _asyncState(PathAsyncState::None), _asyncResult(false), _asyncForceDestination(false),
+    _asyncDestination(G3D::Vector3::zero()), _concurrentBuild(false), _missingTerrain(false)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -89,6 +90,38 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
     return true;
 }
 
+void PathGenerator::SetAsyncDestination(float destX, float destY, float destZ, bool forceDest)
+{
+    _asyncDestination = G3D::Vector3(destX, destY, destZ);
+    _asyncForceDestination = forceDest;
+    _asyncResult = false;
+    _asyncState = PathAsyncState::Pending;
+}
+
+void PathGenerator::CalculateAsyncPath(dtNavMeshQuery const* navMeshQuery, bool concurrent)
+{
+    // Detour queries keep per search state, each pathfinding worker brings its own
+    dtNavMeshQuery const* ownQuery = _navMeshQuery;
+    if (navMeshQuery)
+        _navMeshQuery = navMeshQuery;
+
+    _concurrentBuild = concurrent;
+    _missingTerrain = false;
+    _asyncResult = CalculatePath(_asyncDestination.x, _asyncDestination.y, _asyncDestination.z, _asyncForceDestination);
+    _concurrentBuild = false;
+    _navMeshQuery = ownQuery;
+    _asyncState = PathAsyncState::Done;
+}
+
+bool PathGenerator::HasTerrain(float x, float y) const
+{
+    if (!_concurrentBuild || _source->GetMap()->IsGridCreated(x, y))
+        return true;
+
+    _missingTerrain = true;
+    return false;
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -211,8 +244,12 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     {
         bool buildShortcut = false;
 
-        auto liquidDataStart = _source->GetMap()->GetLiquidData(_source->GetPhaseMask(), startPos.x, startPos.y, startPos.z, _source->GetCollisionHeight(), MAP_ALL_LIQUIDS);
-        auto liquidDataEnd = _source->GetMap()->GetLiquidData(_source->GetPhaseMask(), endPos.x, endPos.y, endPos.z, _source->GetCollisionHeight(), MAP_ALL_LIQUIDS);
+        LiquidData liquidDataStart, liquidDataEnd;
+        if (HasTerrain(startPos.x, startPos.y) && HasTerrain(endPos.x, endPos.y))
+        {
+            liquidDataStart = _source->GetMap()->GetLiquidData(_source->GetPhaseMask(), startPos.x, startPos.y, startPos.z, _source->GetCollisionHeight(), MAP_ALL_LIQUIDS);
+            liquidDataEnd = _source->GetMap()->GetLiquidData(_source->GetPhaseMask(), endPos.x, endPos.y, endPos.z, _source->GetCollisionHeight(), MAP_ALL_LIQUIDS);
+        }
 
         bool startUnderWaterEndInWater = liquidDataStart.Status == LIQUID_MAP_UNDER_WATER &&
                                          (liquidDataEnd.Status & MAP_LIQUID_STATUS_IN_CONTACT) != 0;
@@ -472,15 +509,31 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                startPoly,          // start polygon
-                endPoly,            // end polygon
-                startPoint,         // start position
-                endPoint,           // end position
-                &_filter,           // polygon search filter
-                _pathPolyRefs,     // [out] path
-                (int*)&_polyLength,
-                MAX_PATH_LENGTH);   // max number of polygons in output path
+            // corridors between the same polygons are shared by every mob chasing through them,
+            // only the straight path built on top of it depends on the exact start and end point
+            Map* map = _source->FindMap();
+            PathCache* pathCache = map && map->GetPathCache().IsEnabled() ? &map->GetPathCache() : nullptr;
+            PathCacheKey const cacheKey{ startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+            uint32 const tileGeneration = pathCache ? MMAP::MMapFactory::createOrGetMMapMgr()->GetTileGeneration(_source->GetMapId()) : 0;
+
+            if (pathCache && pathCache->Find(cacheKey, tileGeneration, _pathPolyRefs, _polyLength, MAX_PATH_LENGTH))
+                dtResult = DT_SUCCESS;
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                // partial corridors depend on the exact end point, keep only the complete ones
+                if (pathCache && _polyLength && dtStatusSucceed(dtResult) && _pathPolyRefs[_polyLength - 1] == endPoly)
+                    pathCache->Store(cacheKey, tileGeneration, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -627,6 +680,10 @@ void PathGenerator::NormalizePath()
 {
     for (uint32 i = 0; i < _pathPoints.size(); ++i)
     {
+        // the corridor may cross grids besides the ones of both ends, the path is rebuilt once they exist
+        if (!HasTerrain(_pathPoints[i].x, _pathPoints[i].y))
+            return;
+
         _source->UpdateAllowedPositionZ(_pathPoints[i].x, _pathPoints[i].y, _pathPoints[i].z);
     }
 }
@@ -698,6 +755,9 @@ void PathGenerator::UpdateFilter()
 
 NavTerrain PathGenerator::GetNavTerrain(float x, float y, float z) const
 {
+    if (!HasTerrain(x, y))
+        return NAV_GROUND;
+
     LiquidData const& liquidData = _source->GetMap()->GetLiquidData(_source->GetPhaseMask(), x, y, z, _source->GetCollisionHeight(), MAP_ALL_LIQUIDS);
     if (liquidData.Status == LIQUID_MAP_NO_WATER)
         return NAV_GROUND;
@@ -1148,7 +1208,8 @@ bool PathGenerator::IsSwimmableSegment(float const* v1, float const* v2, bool ch
 bool PathGenerator::IsSwimmableSegment(float x, float y, float z, float destX, float destY, float destZ, bool checkSwim) const
 {
     Creature const* _sourceCreature = _source->ToCreature();
-    return _source->GetMap()->IsInWater(_source->GetPhaseMask(), x, y, z, _source->GetCollisionHeight()) &&
+    return HasTerrain(x, y) && HasTerrain(destX, destY) &&
+        _source->GetMap()->IsInWater(_source->GetPhaseMask(), x, y, z, _source->GetCollisionHeight()) &&
         _source->GetMap()->IsInWater(_source->GetPhaseMask(), destX, destY, destZ, _source->GetCollisionHeight()) &&
         (!checkSwim || !_sourceCreature || _sourceCreature->CanSwim());
 }
@@ -55,6 +55,13 @@ enum PathType
     PATHFIND_FARFROMPOLY       = PATHFIND_FARFROMPOLY_START | PATHFIND_FARFROMPOLY_END, // start or end positions are far from the mmap poligon
 };
 
+enum class PathAsyncState : uint8
+{
+    None,       // not requested asynchronously
+    Pending,    // queued on the map, calculated at the end of its update
+    Done        // result available, see GetAsyncResult()
+};
+
 class PathGenerator
 {
     public:
@@ -74,6 +81,21 @@ class PathGenerator
         [[nodiscard]] bool IsSwimmableSegment(float x, float y, float z, float destX, float destY, float destZ, bool checkSwim = true) const;
         [[nodiscard]] static float GetRequiredHeightToClimb(float x, float y, float z, float destX, float destY, float destZ, float sourceHeight);
 
+        // Asynchronous calculation, the path is built by PathfindingService at the end of the map update.
+        // The generator must not be touched until IsPathPending() returns false.
+        void SetAsyncDestination(float destX, float destY, float destZ, bool forceDest);
+        // concurrent: built next to other paths of the map, terrain of grids that are not created yet is not loaded
+        void CalculateAsyncPath(dtNavMeshQuery const* navMeshQuery, bool concurrent);
+        // The last concurrent build needed terrain that was not loaded, it has to be redone with concurrent = false
+        [[nodiscard]] bool IsMissingTerrain() const { return _missingTerrain; }
+        void CancelAsyncPath() { _asyncState = PathAsyncState::None; }
+        [[nodiscard]] bool IsPathPending() const { return _asyncState == PathAsyncState::Pending; }
+        [[nodiscard]] bool IsAsyncPathReady() const { return _asyncState == PathAsyncState::Done; }
+        [[nodiscard]] bool GetAsyncResult() const { return _asyncResult; }
+        [[nodiscard]] G3D::Vector3 const& GetAsyncDestination() const { return _asyncDestination; }
+        [[nodiscard]] WorldObject const* GetSource() const { return _source; }
+        [[nodiscard]] dtNavMesh const* GetNavMesh() const { return _navMesh; }
+
         // option setters - use optional
 
         // when set, it skips paths with too high slopes (doesn't work with StraightPath enabled)
@@ -150,6 +172,13 @@ class PathGenerator
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
+        PathAsyncState _asyncState;
+        bool _asyncResult;
+        bool _asyncForceDestination;
+        G3D::Vector3 _asyncDestination;
+        bool _concurrentBuild;
+        mutable bool _missingTerrain;
+
         void SetStartPosition(G3D::Vector3 const& point) { _startPosition = point; }
         void SetEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; _endPosition = point; }
         void SetActualEndPosition(G3D::Vector3 const& point) { _actualEndPosition = point; }
@@ -168,6 +197,9 @@ class PathGenerator
         void BuildShortcut();
 
         [[nodiscard]] NavTerrain GetNavTerrain(float x, float y, float z) const;
+
+        // Creating a grid adds navmesh and vmap tiles, which other paths may be searching during a concurrent build
+        [[nodiscard]] bool HasTerrain(float x, float y) const;
         void CreateFilter();
         void UpdateFilter();
 
@@ -26,6 +26,7 @@
 #include "Spell.h"
 #include "Util.h"
 #include "World.h"
+#include <algorithm>
 
 template<class T>
 RandomMovementGenerator<T>::~RandomMovementGenerator() { }
@@ -155,6 +156,8 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
                 Movement::PointsArray::iterator itr = finalPath.begin();
                 Movement::PointsArray::iterator itrNext = finalPath.begin() + 1;
                 float zDiff, distDiff;
+                std::vector<VMAP::LineOfSightQuery> segments;
+                segments.reserve(finalPath.size());
 
                 for (; itrNext != finalPath.end(); ++itr, ++itrNext)
                 {
@@ -170,13 +173,16 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
                         return;
                     }
 
-                    if (!map->isInLineOfSight((*itr).x, (*itr).y, (*itr).z + 2.f, (*itrNext).x, (*itrNext).y, (*itrNext).z + 2.f, creature->GetPhaseMask(),
-                        LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing))
-                    {
-                        _validPointsVector[_currentPoint].erase(randomIter);
-                        _preComputedPaths.erase(pathIdx);
-                        return;
-                    }
+                    segments.push_back({ (*itr).x, (*itr).y, (*itr).z + 2.f, (*itrNext).x, (*itrNext).y, (*itrNext).z + 2.f });
+                }
+
+                // every segment of the path has to be in line of sight, trace them together
+                map->isInLineOfSight(segments.data(), segments.size(), creature->GetPhaseMask(), LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing);
+                if (std::any_of(segments.begin(), segments.end(), [](VMAP::LineOfSightQuery const& segment) { return !segment.InLineOfSight; }))
+                {
+                    _validPointsVector[_currentPoint].erase(randomIter);
+                    _preComputedPaths.erase(pathIdx);
+                    return;
                 }
 
                 // no valid path
@@ -18,11 +18,14 @@
 #include "TargetedMovementGenerator.h"
 #include "Creature.h"
 #include "CreatureAI.h"
+#include "Map.h"
 #include "MoveSplineInit.h"
+#include "PathfindingService.h"
 #include "Pet.h"
 #include "Player.h"
 #include "Spell.h"
 #include "Transport.h"
+#include <type_traits>
 
 static bool IsMutualChase(Unit* owner, Unit* target)
 {
@@ -79,6 +82,8 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
     {
         owner->StopMoving();
         _lastTargetPosition.reset();
+        if (i_path && (i_path->IsPathPending() || i_path->IsAsyncPathReady()))
+            ResetPath();
         if (cOwner)
         {
             if (isStoppedBecauseOfCasting)
@@ -142,7 +147,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             if ((owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && !target->isMoving() && !mutualChase) || _range)
             {
                 i_recalculateTravel = false;
-                i_path = nullptr;
+                ResetPath();
                 if (cOwner)
                     cOwner->SetCannotReachTarget();
                 owner->StopMoving();
@@ -157,7 +162,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
     if (owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && owner->movespline->Finalized())
     {
         i_recalculateTravel = false;
-        i_path = nullptr;
+        ResetPath();
         if (cOwner)
             cOwner->SetCannotReachTarget();
         owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
@@ -180,6 +185,17 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             i_leashExtensionTimer.Reset(cOwner->GetAttackTime(BASE_ATTACK));
     }
 
+    // paths requested from the pathfinding service are built at the end of the map update
+    if (i_path && i_path->IsPathPending())
+        return true;
+
+    if (i_path && i_path->IsAsyncPathReady())
+    {
+        i_path->CancelAsyncPath();
+        LaunchPath(owner, target, i_path->GetAsyncResult(), i_path->GetAsyncDestination(), _pendingShortenPath, _pendingMaxTarget);
+        return true;
+    }
+
     // if the target moved, we have to consider whether to adjust
     if (!_lastTargetPosition || target->GetPosition() != _lastTargetPosition.value() || mutualChase != _mutualChase || !owner->IsWithinLOSInMap(target))
     {
@@ -192,7 +208,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             {
                 cOwner->SetCannotReachTarget(target->GetGUID());
                 cOwner->StopMoving();
-                i_path = nullptr;
+                ResetPath();
                 return true;
             }
 
@@ -205,7 +221,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
 
             // make a new path if we have to...
             if (!i_path || moveToward != _movingTowards)
-                i_path = std::make_unique<PathGenerator>(owner);
+                i_path = std::make_shared<PathGenerator>(owner);
             else
                 i_path->Clear();
 
@@ -246,61 +262,89 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = i_path->CalculatePath(x, y, z, forceDest);
-            if (!success || i_path->GetPathType() & PATHFIND_NOPATH)
+            // long paths are built by the pathfinding service at the end of the map update
+            if (std::is_same_v<T, Creature> && sPathfindingService->IsEnabled() && !owner->IsInDist(x, y, z, sPathfindingService->GetSyncDistance()))
             {
-                if (cOwner)
-                {
-                    cOwner->SetCannotReachTarget(target->GetGUID());
-                }
-
-                owner->StopMoving();
+                i_path->SetAsyncDestination(x, y, z, forceDest);
+                owner->GetMap()->QueuePathRequest(i_path);
+                _pendingShortenPath = shortenPath;
+                _pendingMaxTarget = maxTarget;
                 return true;
             }
 
-            if (shortenPath)
-                i_path->ShortenPathUntilDist(G3D::Vector3(x, y, z), maxTarget);
+            bool success = i_path->CalculatePath(x, y, z, forceDest);
+            LaunchPath(owner, target, success, G3D::Vector3(x, y, z), shortenPath, maxTarget);
+        }
+    }
 
-            if (cOwner)
-            {
-                cOwner->SetCannotReachTarget();
-            }
+    return true;
+}
 
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
-            {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                case CreatureChaseMovementType::CanWalk:
-                    walk = owner->IsWalking();
-                    break;
-                case CreatureChaseMovementType::AlwaysWalk:
-                    walk = true;
-                    break;
-                default:
-                    break;
-                }
-            }
+template<class T>
+void ChaseMovementGenerator<T>::ResetPath()
+{
+    // the map may still hold a pending request, it skips cancelled paths
+    if (i_path)
+        i_path->CancelAsyncPath();
 
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            i_recalculateTravel = true;
+    i_path = nullptr;
+}
 
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(i_path->GetPath());
-            init.SetFacing(target);
-            init.SetWalk(walk);
-            init.Launch();
+template<class T>
+void ChaseMovementGenerator<T>::LaunchPath(T* owner, Unit* target, bool success, G3D::Vector3 const& dest, bool shortenPath, float maxTarget)
+{
+    Creature* cOwner = owner->ToCreature();
+
+    if (!success || i_path->GetPathType() & PATHFIND_NOPATH)
+    {
+        if (cOwner)
+        {
+            cOwner->SetCannotReachTarget(target->GetGUID());
         }
+
+        owner->StopMoving();
+        return;
     }
 
-    return true;
+    if (shortenPath)
+        i_path->ShortenPathUntilDist(dest, maxTarget);
+
+    if (cOwner)
+    {
+        cOwner->SetCannotReachTarget();
+    }
+
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+        case CreatureChaseMovementType::CanWalk:
+            walk = owner->IsWalking();
+            break;
+        case CreatureChaseMovementType::AlwaysWalk:
+            walk = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    i_recalculateTravel = true;
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(i_path->GetPath());
+    init.SetFacing(target);
+    init.SetWalk(walk);
+    init.Launch();
 }
 
 //-----------------------------------------------//
 template<>
 void ChaseMovementGenerator<Player>::DoInitialize(Player* owner)
 {
-    i_path = nullptr;
+    ResetPath();
     _lastTargetPosition.reset();
     owner->StopMoving();
     owner->AddUnitState(UNIT_STATE_CHASE);
@@ -309,7 +353,7 @@ void ChaseMovementGenerator<Player>::DoInitialize(Player* owner)
 template<>
 void ChaseMovementGenerator<Creature>::DoInitialize(Creature* owner)
 {
-    i_path = nullptr;
+    ResetPath();
     _lastTargetPosition.reset();
     i_recheckDistance.Reset(0);
     i_leashExtensionTimer.Reset(owner->GetAttackTime(BASE_ATTACK));
@@ -40,7 +40,7 @@ class ChaseMovementGenerator : public MovementGeneratorMedium<T, ChaseMovementGe
 public:
     ChaseMovementGenerator(Unit* target, Optional<ChaseRange> range = {}, Optional<ChaseAngle> angle = {})
         : TargetedMovementGeneratorBase(target), i_leashExtensionTimer(5000), i_path(nullptr), i_recheckDistance(0), i_recalculateTravel(true), _range(range), _angle(angle) {}
-    ~ChaseMovementGenerator() { }
+    ~ChaseMovementGenerator() { ResetPath(); }
 
     MovementGeneratorType GetMovementGeneratorType() { return CHASE_MOTION_TYPE; }
 
@@ -59,8 +59,11 @@ public:
     bool HasLostTarget(Unit* unit) const { return unit->GetVictim() != this->GetTarget(); }
 
 private:
+    void ResetPath();
+    void LaunchPath(T* owner, Unit* target, bool success, G3D::Vector3 const& dest, bool shortenPath, float maxTarget);
+
     TimeTrackerSmall i_leashExtensionTimer;
-    std::unique_ptr<PathGenerator> i_path;
+    std::shared_ptr<PathGenerator> i_path; // shared with the map while the path is built asynchronously
     TimeTrackerSmall i_recheckDistance;
     bool i_recalculateTravel;
 
@@ -69,6 +72,8 @@ private:
     Optional<ChaseAngle> const _angle;
     bool _movingTowards = true;
     bool _mutualChase = true;
+    bool _pendingShortenPath = false;
+    float _pendingMaxTarget = 0.0f;
 };
 
 template<class T>
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCache.h"
+#include <algorithm>
+
+void PathCache::SetCapacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _capacity = capacity;
+    while (_entries.size() > _capacity)
+    {
+        _index.erase(_entries.back().Key);
+        _entries.pop_back();
+    }
+}
+
+void PathCache::CheckGeneration(uint32 tileGeneration)
+{
+    if (tileGeneration == _tileGeneration)
+        return;
+
+    _entries.clear();
+    _index.clear();
+    _tileGeneration = tileGeneration;
+}
+
+bool PathCache::Find(PathCacheKey const& key, uint32 tileGeneration, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    CheckGeneration(tileGeneration);
+
+    auto itr = _index.find(key);
+    if (itr == _index.end() || itr->second->Path.size() > maxPathLength)
+    {
+        ++_misses;
+        return false;
+    }
+
+    _entries.splice(_entries.begin(), _entries, itr->second);
+
+    std::vector<dtPolyRef> const& cached = itr->second->Path;
+    std::copy(cached.begin(), cached.end(), path);
+    pathLength = uint32(cached.size());
+    ++_hits;
+    return true;
+}
+
+void PathCache::Store(PathCacheKey const& key, uint32 tileGeneration, dtPolyRef const* path, uint32 pathLength)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_capacity)
+        return;
+
+    CheckGeneration(tileGeneration);
+
+    auto itr = _index.find(key);
+    if (itr != _index.end())
+    {
+        itr->second->Path.assign(path, path + pathLength);
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return;
+    }
+
+    if (_entries.size() >= _capacity)
+    {
+        _index.erase(_entries.back().Key);
+        _entries.pop_back();
+    }
+
+    _entries.push_front({ key, std::vector<dtPolyRef>(path, path + pathLength) });
+    _index.emplace(key, _entries.begin());
+}
+
+void PathCache::ConsumeStats(uint32& hits, uint32& misses)
+{
+    hits = _hits.exchange(0);
+    misses = _misses.exchange(0);
+}
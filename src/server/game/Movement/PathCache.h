@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_PATH_CACHE_H
+#define ACORE_PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct PathCacheKey
+{
+    dtPolyRef StartPoly;
+    dtPolyRef EndPoly;
+    uint16 IncludeFlags;
+    uint16 ExcludeFlags;
+
+    bool operator==(PathCacheKey const& right) const = default;
+};
+
+struct PathCacheKeyHash
+{
+    std::size_t operator()(PathCacheKey const& key) const
+    {
+        std::size_t hash = std::hash<dtPolyRef>()(key.StartPoly);
+        hash ^= std::hash<dtPolyRef>()(key.EndPoly) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= ((std::size_t(key.IncludeFlags) << 16) | key.ExcludeFlags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+// Bounded LRU of poly corridors found by PathGenerator, per map.
+// A corridor stays valid while its start and end points remain on the same polygons,
+// only the straight path through it has to be rebuilt. Any navmesh tile load or unload
+// changes the tile generation of the map and drops every cached corridor.
+class PathCache
+{
+public:
+    PathCache() = default;
+
+    void SetCapacity(std::size_t capacity);
+    [[nodiscard]] bool IsEnabled() const { return _capacity != 0; }
+
+    // Copies the cached corridor into path, which must hold maxPathLength refs
+    bool Find(PathCacheKey const& key, uint32 tileGeneration, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength);
+    void Store(PathCacheKey const& key, uint32 tileGeneration, dtPolyRef const* path, uint32 pathLength);
+
+    // Lookups since the last call
+    void ConsumeStats(uint32& hits, uint32& misses);
+
+private:
+    struct Entry
+    {
+        PathCacheKey Key;
+        std::vector<dtPolyRef> Path;
+    };
+
+    void CheckGeneration(uint32 tileGeneration);
+
+    // paths of one map may be built on several pathfinding workers at once
+    std::mutex _lock;
+    std::list<Entry> _entries; // most recently used first
+    std::unordered_map<PathCacheKey, std::list<Entry>::iterator, PathCacheKeyHash> _index;
+    std::size_t _capacity = 0;
+    uint32 _tileGeneration = 0;
+
+    std::atomic<uint32> _hits{0};
+    std::atomic<uint32> _misses{0};
+};
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathfindingService.h"
+#include "DetourNavMeshQuery.h"
+#include "Errors.h"
+#include "Log.h"
+#include "PathGenerator.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    // Navmesh queries owned by the current thread, one per navmesh it has searched
+    class ThreadNavMeshQueries
+    {
+    public:
+        ~ThreadNavMeshQueries()
+        {
+            for (auto const& [navMesh, query] : _queries)
+                dtFreeNavMeshQuery(query);
+        }
+
+        dtNavMeshQuery const* Get(dtNavMesh const* navMesh)
+        {
+            if (!navMesh)
+                return nullptr;
+
+            auto itr = _queries.find(navMesh);
+            if (itr != _queries.end())
+                return itr->second;
+
+            dtNavMeshQuery* query = dtAllocNavMeshQuery();
+            ASSERT(query);
+            if (dtStatusFailed(query->init(navMesh, 1024)))
+            {
+                LOG_ERROR("maps", "PathfindingService: Failed to initialize dtNavMeshQuery");
+                dtFreeNavMeshQuery(query);
+                return nullptr;
+            }
+
+            // a navmesh freed and reallocated at the same address is harmless, init only
+            // stores the pointer and every search starts by clearing the node pools
+            _queries.emplace(navMesh, query);
+            return query;
+        }
+
+    private:
+        std::unordered_map<dtNavMesh const*, dtNavMeshQuery*> _queries;
+    };
+
+    thread_local ThreadNavMeshQueries threadNavMeshQueries;
+}
+
+struct PathfindingService::Batch
+{
+    explicit Batch(std::vector<std::shared_ptr<PathGenerator>> const& paths) : Paths(paths), Count(paths.size()) { }
+
+    // owned by the caller of CalculatePaths, only valid until every path is done
+    std::vector<std::shared_ptr<PathGenerator>> const& Paths;
+    std::size_t const Count;
+    std::atomic<std::size_t> Next{0};
+    std::atomic<std::size_t> Done{0};
+    std::mutex Lock;
+    std::condition_variable Finished;
+};
+
+PathfindingService* PathfindingService::instance()
+{
+    static PathfindingService instance;
+    return &instance;
+}
+
+void PathfindingService::Initialize(std::size_t numThreads, float syncDistance)
+{
+    _syncDistance = syncDistance;
+    if (!numThreads)
+        return;
+
+    _cancelationToken = false;
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&PathfindingService::WorkerThread, this));
+
+    LOG_INFO("server.loading", "Pathfinding service started with {} thread(s)", numThreads);
+}
+
+void PathfindingService::Shutdown()
+{
+    if (!IsEnabled())
+        return;
+
+    _cancelationToken = true;
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+}
+
+void PathfindingService::CalculatePaths(std::vector<std::shared_ptr<PathGenerator>> const& paths)
+{
+    if (paths.empty())
+        return;
+
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>(paths);
+
+    // wake up as many workers as there is work for, the calling thread handles a share itself
+    std::size_t const helpers = std::min(_workerThreads.size(), paths.size() - 1);
+    for (std::size_t i = 0; i < helpers; ++i)
+        _queue.Push(batch);
+
+    Run(*batch);
+
+    std::unique_lock<std::mutex> lock(batch->Lock);
+    batch->Finished.wait(lock, [&batch, &paths] { return batch->Done.load() == paths.size(); });
+    lock.unlock();
+
+    // loading terrain is only safe once the workers are done, redo the paths that ran into a missing grid
+    for (std::shared_ptr<PathGenerator> const& path : paths)
+        if (path->IsMissingTerrain())
+            path->CalculateAsyncPath(nullptr, false);
+}
+
+void PathfindingService::Run(Batch& batch)
+{
+    std::size_t const count = batch.Count;
+    for (std::size_t i = batch.Next++; i < count; i = batch.Next++)
+    {
+        PathGenerator& path = *batch.Paths[i];
+        path.CalculateAsyncPath(threadNavMeshQueries.Get(path.GetNavMesh()), true);
+
+        if (++batch.Done == count)
+        {
+            std::lock_guard<std::mutex> guard(batch.Lock);
+            batch.Finished.notify_all();
+        }
+    }
+}
+
+void PathfindingService::WorkerThread()
+{
+    while (!_cancelationToken)
+    {
+        std::shared_ptr<Batch> batch;
+        _queue.WaitAndPop(batch);
+
+        if (!_cancelationToken && batch)
+            Run(*batch);
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_PATHFINDING_SERVICE_H
+#define ACORE_PATHFINDING_SERVICE_H
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class PathGenerator;
+
+// Spreads the path requests queued by a map during its update over a pool of workers.
+// Map::Update hands its batch over once all objects have been updated and waits for it,
+// so the units, terrain and navmesh read by the path builders are not modified meanwhile.
+// Workers never create grids, a path that needs one is rebuilt on the calling thread afterwards.
+// dtNavMeshQuery keeps per search state, every worker owns one query per navmesh.
+class PathfindingService
+{
+    struct Batch;
+
+public:
+    static PathfindingService* instance();
+
+    void Initialize(std::size_t numThreads, float syncDistance);
+    void Shutdown();
+
+    [[nodiscard]] bool IsEnabled() const { return !_workerThreads.empty(); }
+
+    // Paths shorter than this are cheap enough to be built inline
+    [[nodiscard]] float GetSyncDistance() const { return _syncDistance; }
+
+    // Builds all pending paths, the calling thread takes part and returns once every path is done
+    void CalculatePaths(std::vector<std::shared_ptr<PathGenerator>> const& paths);
+
+private:
+    PathfindingService() = default;
+    ~PathfindingService() = default;
+
+    void WorkerThread();
+    static void Run(Batch& batch);
+
+    ProducerConsumerQueue<std::shared_ptr<Batch>> _queue;
+    std::atomic<bool> _cancelationToken{};
+    std::vector<std::thread> _workerThreads;
+    float _syncDistance = 0.0f;
+};
+
+#define sPathfindingService PathfindingService::instance()
+
+#endif
@@ -18,6 +18,7 @@
 #ifndef _SCRIPT_MGR_MACRO_H_
 #define _SCRIPT_MGR_MACRO_H_
 
+#include "Profiler.h"
 #include "ScriptMgr.h"
 
 template<typename ScriptName>
@@ -69,20 +70,25 @@ inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
     return ret && *ret ? need : !need;
 }
 
+// Hooks are profiled by hook and then by script, see Profiler
+#define PROFILE_HOOK(hookType) \
+    ACORE_PROFILE_SCOPE(#hookType); \
+    ACORE_PROFILE_SCOPE(script->GetName())
+
 #define CALL_ENABLED_HOOKS(scriptType, hookType, action) \
     if (!ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
-        for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { action; }
+        for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { PROFILE_HOOK(hookType); action; }
 
 #define CALL_ENABLED_BOOLEAN_HOOKS(scriptType, hookType, action) \
     if (ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
         return true; \
-    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { if (action) return false; } \
+    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { PROFILE_HOOK(hookType); if (action) return false; } \
     return true;
 
 #define CALL_ENABLED_BOOLEAN_HOOKS_WITH_DEFAULT_FALSE(scriptType, hookType, action) \
     if (ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
         return false; \
-    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { if (action) return true; } \
+    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { PROFILE_HOOK(hookType); if (action) return true; } \
     return false;
 
 #endif // _SCRIPT_MGR_MACRO_H_
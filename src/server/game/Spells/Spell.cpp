@@ -39,6 +39,7 @@
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "SharedDefines.h"
 #include "SpellAuraEffects.h"
@@ -3805,6 +3806,8 @@ void Spell::cancel(bool bySelf)
 
 void Spell::cast(bool skipCheck)
 {
+    ACORE_PROFILE_SCOPE("Spell {}", m_spellInfo->Id);
+
     Player* modOwner = m_caster->GetSpellModOwner();
     Spell* lastMod = nullptr;
     if (modOwner)
@@ -4193,6 +4196,8 @@ void Spell::handle_immediate()
 
 uint64 Spell::handle_delayed(uint64 t_offset)
 {
+    ACORE_PROFILE_SCOPE("Spell {}", m_spellInfo->Id);
+
     if (!UpdatePointers())
     {
         // finish the spell if UpdatePointers() returned false, something wrong happened there
@@ -250,32 +250,35 @@ class SpellEffectInfo
     SpellInfo const* _spellInfo;
     uint8 _effIndex;
 public:
+    // Checked on every aura and target lookup, kept in the first cache line of the effect
     uint32    Effect;
     uint32    ApplyAuraName;
-    uint32    Amplitude;
-    int32     DieSides;
-    float     RealPointsPerLevel;
+    SpellImplicitTargetInfo TargetA;
+    SpellImplicitTargetInfo TargetB;
+    Mechanics Mechanic;
+    int32     MiscValue;
+    int32     MiscValueB;
     int32     BasePoints;
-    float     PointsPerComboPoint;
+    int32     DieSides;
+    uint32    Amplitude;
+    uint32    TriggerSpell;
+    flag96    SpellClassMask;
+
+    // Used when the effect is calculated or its targets are searched
+    uint32    ChainTarget;
+    SpellRadiusEntry const* RadiusEntry;
     float     ValueMultiplier;
     float     DamageMultiplier;
     float     BonusMultiplier;
-    int32     MiscValue;
-    int32     MiscValueB;
-    Mechanics Mechanic;
-    SpellImplicitTargetInfo TargetA;
-    SpellImplicitTargetInfo TargetB;
-    SpellRadiusEntry const* RadiusEntry;
-    uint32    ChainTarget;
+    float     RealPointsPerLevel;
+    float     PointsPerComboPoint;
     uint32    ItemType;
-    uint32    TriggerSpell;
-    flag96    SpellClassMask;
     std::list<Condition*>* ImplicitTargetConditions;
 
-    SpellEffectInfo() : _spellInfo(nullptr), _effIndex(0), Effect(0), ApplyAuraName(0), Amplitude(0), DieSides(0),
-        RealPointsPerLevel(0), BasePoints(0), PointsPerComboPoint(0), ValueMultiplier(0), DamageMultiplier(0),
-        BonusMultiplier(0), MiscValue(0), MiscValueB(0), Mechanic(MECHANIC_NONE), RadiusEntry(nullptr), ChainTarget(0),
-        ItemType(0), TriggerSpell(0), ImplicitTargetConditions(nullptr) {}
+    SpellEffectInfo() : _spellInfo(nullptr), _effIndex(0), Effect(0), ApplyAuraName(0), Mechanic(MECHANIC_NONE),
+        MiscValue(0), MiscValueB(0), BasePoints(0), DieSides(0), Amplitude(0), TriggerSpell(0), ChainTarget(0),
+        RadiusEntry(nullptr), ValueMultiplier(0), DamageMultiplier(0), BonusMultiplier(0), RealPointsPerLevel(0),
+        PointsPerComboPoint(0), ItemType(0), ImplicitTargetConditions(nullptr) {}
     SpellEffectInfo(SpellEntry const* spellEntry, SpellInfo const* spellInfo, uint8 effIndex);
 
     bool IsEffect() const;
@@ -312,15 +315,15 @@ private:
     static std::array<StaticData, TOTAL_SPELL_EFFECTS> _data;
 };
 
+// Members are ordered by how often combat code reads them. The attributes and the
+// effects come first so the checks done for every cast and aura touch only the first
+// cache lines, names, reagents and client visuals are at the end and rarely loaded.
 class AC_GAME_API SpellInfo
 {
 friend class SpellMgr;
 
 public:
-    uint32 Id;
-    SpellCategoryEntry const* CategoryEntry;
-    uint32 Dispel;
-    uint32 Mechanic;
+    alignas(64) uint32 Id;
     uint32 Attributes;
     uint32 AttributesEx;
     uint32 AttributesEx2;
@@ -330,10 +333,45 @@ public:
     uint32 AttributesEx6;
     uint32 AttributesEx7;
     uint32 AttributesCu;
-    uint32 Stances;
-    uint32 StancesNot;
+    uint32 SchoolMask;
+    uint32 DmgClass;
+    uint32 PreventionType;
+    uint32 Dispel;
+    uint32 Mechanic;
+    uint32 SpellFamilyName;
+    flag96 SpellFamilyFlags;
+    uint32 ExplicitTargetMask;
     uint32 Targets;
     uint32 TargetCreatureType;
+    uint32 InterruptFlags;
+    uint32 AuraInterruptFlags;
+    uint32 ChannelInterruptFlags;
+    uint32 ProcFlags;
+    uint32 ProcChance;
+    uint32 ProcCharges;
+    uint32 StackAmount;
+    uint32 MaxAffectedTargets;
+    uint32 MaxTargetLevel;
+    float  Speed;
+    SpellCastTimesEntry const* CastTimeEntry;
+    SpellDurationEntry const* DurationEntry;
+    SpellRangeEntry const* RangeEntry;
+    SpellCategoryEntry const* CategoryEntry;
+    SpellChainNode const* ChainEntry;
+
+    // Mine
+    AuraStateType _auraState;
+    SpellSpecificType _spellSpecific;
+    bool _isStackableWithRanks;
+    bool _isSpellValid;
+    bool _isCritCapable;
+    bool _requireCooldownInfo;
+
+    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
+
+    // Only read when a cast is checked and started
+    uint32 Stances;
+    uint32 StancesNot;
     uint32 RequiresSpellFocus;
     uint32 FacingCasterFlags;
     uint32 CasterAuraState;
@@ -344,21 +382,13 @@ public:
     uint32 TargetAuraSpell;
     uint32 ExcludeCasterAuraSpell;
     uint32 ExcludeTargetAuraSpell;
-    SpellCastTimesEntry const* CastTimeEntry;
     uint32 RecoveryTime;
     uint32 CategoryRecoveryTime;
     uint32 StartRecoveryCategory;
     uint32 StartRecoveryTime;
-    uint32 InterruptFlags;
-    uint32 AuraInterruptFlags;
-    uint32 ChannelInterruptFlags;
-    uint32 ProcFlags;
-    uint32 ProcChance;
-    uint32 ProcCharges;
     uint32 MaxLevel;
     uint32 BaseLevel;
     uint32 SpellLevel;
-    SpellDurationEntry const* DurationEntry;
     uint32 PowerType;
     uint32 ManaCost;
     uint32 ManaCostPerlevel;
@@ -366,15 +396,15 @@ public:
     uint32 ManaPerSecondPerLevel;
     uint32 ManaCostPercentage;
     uint32 RuneCostID;
-    SpellRangeEntry const* RangeEntry;
-    float  Speed;
-    uint32 StackAmount;
-    std::array<uint32, 2> Totem;
-    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
-    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
+    int32  AreaGroupId;
     int32  EquippedItemClass;
     int32  EquippedItemSubClassMask;
     int32  EquippedItemInventoryTypeMask;
+
+    // Cold: reagents, client visuals and localized strings
+    std::array<uint32, 2> Totem;
+    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
+    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
     std::array<uint32, 2> TotemCategory;
     std::array<uint32, 2> SpellVisual;
     uint32 SpellIconID;
@@ -382,25 +412,6 @@ public:
     uint32 SpellPriority;
     std::array<char const*, 16> SpellName;
     std::array<char const*, 16> Rank;
-    uint32 MaxTargetLevel;
-    uint32 MaxAffectedTargets;
-    uint32 SpellFamilyName;
-    flag96 SpellFamilyFlags;
-    uint32 DmgClass;
-    uint32 PreventionType;
-    int32  AreaGroupId;
-    uint32 SchoolMask;
-    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
-    uint32 ExplicitTargetMask;
-    SpellChainNode const* ChainEntry;
-
-    // Mine
-    AuraStateType _auraState;
-    SpellSpecificType _spellSpecific;
-    bool _isStackableWithRanks;
-    bool _isSpellValid;
-    bool _isCritCapable;
-    bool _requireCooldownInfo;
 
     SpellInfo(SpellEntry const* spellEntry);
     ~SpellInfo();
@@ -70,7 +70,9 @@
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerSaveScheduler.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
 #include "ServerMailMgr.h"
@@ -78,6 +80,7 @@
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "TaskGraph.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
@@ -299,6 +302,26 @@ void World::LoadConfigSettings(bool reload)
     sScriptMgr->OnAfterConfigLoad(reload);
 }
 
+/// Runs a group of startup loaders and reports which chain of them bounded the wall clock time
+static void RunLoaderGraph(Acore::TaskGraph& graph, std::string_view stage, uint32 threadCount)
+{
+    graph.Run(threadCount);
+
+    std::string criticalPath;
+    for (Acore::TaskGraph::TaskId task : graph.GetCriticalPath())
+    {
+        if (!criticalPath.empty())
+            criticalPath += " -> ";
+
+        criticalPath += Acore::StringFormat("{} ({:.2f} ms)", graph.GetName(task), graph.GetTime(task).count() / 1000.0);
+    }
+
+    LOG_INFO("server.loading", ">> {} loaded in {:.2f} ms, {:.2f} ms of work in {} loader(s)", stage,
+        graph.GetRunTime().count() / 1000.0, graph.GetTotalTime().count() / 1000.0, graph.GetSize());
+    LOG_INFO("server.loading", "   critical path: {}", criticalPath);
+    LOG_INFO("server.loading", " ");
+}
+
 /// Initialize the World
 void World::SetInitialWorldSettings()
 {
@@ -451,28 +474,29 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    LOG_INFO("server.loading", "Loading Localization Strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+    LOG_INFO("server.loading", "Loading Broadcast Texts and Localization Strings...");
+    {
+        // Every loader below fills its own store and reads nothing the others write
+        Acore::TaskGraph localeLoaders;
+        Acore::TaskGraph::TaskId broadcastTexts = localeLoaders.AddTask("broadcast_text", [] { sObjectMgr->LoadBroadcastTexts(); });
+        localeLoaders.AddTask("broadcast_text_locale", [] { sObjectMgr->LoadBroadcastTextLocales(); }, { broadcastTexts });
+        localeLoaders.AddTask("creature_template_locale", [] { sObjectMgr->LoadCreatureLocales(); });
+        localeLoaders.AddTask("gameobject_template_locale", [] { sObjectMgr->LoadGameObjectLocales(); });
+        localeLoaders.AddTask("item_template_locale", [] { sObjectMgr->LoadItemLocales(); });
+        localeLoaders.AddTask("item_set_names_locale", [] { sObjectMgr->LoadItemSetNameLocales(); });
+        localeLoaders.AddTask("quest_template_locale", [] { sObjectMgr->LoadQuestLocales(); });
+        localeLoaders.AddTask("quest_offer_reward_locale", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+        localeLoaders.AddTask("quest_request_items_locale", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+        localeLoaders.AddTask("npc_text_locale", [] { sObjectMgr->LoadNpcTextLocales(); });
+        localeLoaders.AddTask("page_text_locale", [] { sObjectMgr->LoadPageTextLocales(); });
+        localeLoaders.AddTask("gossip_menu_option_locale", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+        localeLoaders.AddTask("points_of_interest_locale", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+        localeLoaders.AddTask("pet_name_generation_locale", [] { sObjectMgr->LoadPetNamesLocales(); });
+
+        RunLoaderGraph(localeLoaders, "Broadcast Texts and Localization Strings", getIntConfig(CONFIG_WORLD_LOAD_THREADS));
+    }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
 
     LOG_INFO("server.loading", "Loading Page Texts...");
     sObjectMgr->LoadPageTexts();
@@ -707,20 +731,18 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Load Mail Server definitions...");
     sServerMailMgr->LoadMailServerTemplates();
 
-    // Loot tables
-    LoadLootTables();
-
-    LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-
-    LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
+    LOG_INFO("server.loading", "Loading Loot Tables and Skill Tables...");
+    {
+        // Loot and skill tables only read the item, creature, gameobject and spell data loaded above
+        Acore::TaskGraph lootLoaders;
+        AddLootTableLoaders(lootLoaders);
+        lootLoaders.AddTask("skill_discovery_template", LoadSkillDiscoveryTable);
+        lootLoaders.AddTask("skill_extra_item_template", LoadSkillExtraItemTable);
+        lootLoaders.AddTask("skill_perfect_item_template", LoadSkillPerfectItemTable);
+        lootLoaders.AddTask("skill_fishing_base_level", [] { sObjectMgr->LoadFishingBaseSkillLevel(); });
+
+        RunLoaderGraph(lootLoaders, "Loot Tables and Skill Tables", getIntConfig(CONFIG_WORLD_LOAD_THREADS));
+    }
 
     LOG_INFO("server.loading", "Loading Achievements...");
     sAchievementMgr->LoadAchievementReferenceList();
@@ -1092,6 +1114,7 @@ void World::DetectDBCLang()
 void World::Update(uint32 diff)
 {
     METRIC_TIMER("world_update_time_total");
+    ACORE_PROFILE_SCOPE("World::Update");
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
@@ -1222,6 +1245,11 @@ void World::Update(uint32 diff)
         sMapMgr->Update(diff);
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Save players"));
+        sPlayerSaveScheduler->Update(diff);
+    }
+
     if (getBoolConfig(CONFIG_AUTOBROADCAST))
     {
         if (_timers[WUPDATE_AUTOBROADCAST].Passed())
@@ -1311,6 +1339,13 @@ void World::Update(uint32 diff)
         WorldDatabase.KeepAlive();
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update database pools"));
+        CharacterDatabase.Update(diff);
+        LoginDatabase.Update(diff);
+        WorldDatabase.Update(diff);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update instance reset times"));
         // update the instance reset times
@@ -160,6 +160,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_INTERVAL_SAVE, "PlayerSaveInterval", 900000);
     SetConfigValue<uint32>(CONFIG_INTERVAL_DISCONNECT_TOLERANCE, "DisconnectToleranceInterval", 0);
     SetConfigValue<bool>(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    SetConfigValue<bool>(CONFIG_PLAYER_SAVE_SKIP_UNCHANGED, "PlayerSave.SkipUnchanged", true);
+    SetConfigValue<bool>(CONFIG_PLAYER_SAVE_SCHEDULER, "PlayerSave.Scheduler.Enabled", true);
+    SetConfigValue<uint32>(CONFIG_PLAYER_SAVE_STATEMENTS_PER_SECOND, "PlayerSave.Scheduler.StatementsPerSecond", 0);
+    SetConfigValue<uint32>(CONFIG_PLAYER_SAVE_MAX_DB_QUEUE, "PlayerSave.Scheduler.MaxQueueSize", 1000);
     SetConfigValue<bool>(CONFIG_VALIDATE_SKILL_LEARNED_BY_SPELLS, "ValidateSkillLearnedBySpells", true);
 
     SetConfigValue<uint32>(CONFIG_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value < MAX_LEVEL; }, "< MAX_LEVEL");
@@ -182,6 +186,8 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<uint32>(CONFIG_GAME_TYPE, "GameType", 0, ConfigValueCache::Reloadable::No);
     SetConfigValue<uint32>(CONFIG_REALM_ZONE, "RealmZone", REALM_ZONE_DEVELOPMENT, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_DBC_LOAD_THREADS, "DBC.LoadThreads", 0, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_WORLD_LOAD_THREADS, "World.LoadThreads", 0, ConfigValueCache::Reloadable::No);
 
     SetConfigValue<bool>(CONFIG_STRICT_NAMES_RESERVED, "StrictNames.Reserved", true);
     SetConfigValue<bool>(CONFIG_STRICT_NAMES_PROFANITY, "StrictNames.Profanity", true);
@@ -516,6 +522,7 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_PVP_LOS, "vmap.BlizzlikePvPLOS", true);
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD, "vmap.BlizzlikeLOSInOpenWorld", true);
+    SetConfigValue<uint32>(CONFIG_VMAP_LOS_CACHE_SIZE, "vmap.LoSCacheSize", 1024);
 
     SetConfigValue<bool>(CONFIG_START_CUSTOM_SPELLS, "PlayerStart.CustomSpells", false);
     SetConfigValue<uint32>(CONFIG_HONOR_AFTER_DUEL, "HonorPointsAfterDuel", 0);
@@ -533,6 +540,8 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<uint32>(CONFIG_MAP_PRELOAD_THREADS, "MapUpdate.PreloadThreads", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_PRELOAD_MAX_GRIDS, "MapUpdate.PreloadMaxGrids", 64);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -569,6 +578,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_PDUMP_NO_PATHS, "PlayerDump.DisallowPaths", true);
     SetConfigValue<bool>(CONFIG_PDUMP_NO_OVERWRITE, "PlayerDump.DisallowOverwrite", true);
     SetConfigValue<bool>(CONFIG_ENABLE_MMAPS, "MoveMaps.Enable", true);
+    SetConfigValue<bool>(CONFIG_MEMORY_MAPPED_DATA, "DataDir.MemoryMapped", false);
+    SetConfigValue<uint32>(CONFIG_MMAP_ASYNC_THREADS, "MoveMaps.AsyncThreads", 0);
+    SetConfigValue<float>(CONFIG_MMAP_ASYNC_MIN_DISTANCE, "MoveMaps.AsyncMinDistance", 10.0f);
+    SetConfigValue<uint32>(CONFIG_MMAP_PATH_CACHE_SIZE, "MoveMaps.PathCacheSize", 256);
 
     // Wintergrasp
     SetConfigValue<uint32>(CONFIG_WINTERGRASP_ENABLE, "Wintergrasp.Enable", 1);
@@ -27,6 +27,8 @@ enum ServerConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_PLAYER_SAVE_SKIP_UNCHANGED,
+    CONFIG_PLAYER_SAVE_SCHEDULER,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CHAT,
@@ -98,6 +100,10 @@ enum ServerConfigs
     CONFIG_PDUMP_NO_PATHS,
     CONFIG_PDUMP_NO_OVERWRITE,
     CONFIG_ENABLE_MMAPS,
+    CONFIG_MEMORY_MAPPED_DATA,
+    CONFIG_MMAP_ASYNC_THREADS,
+    CONFIG_MMAP_ASYNC_MIN_DISTANCE,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
     CONFIG_ENABLE_LOGIN_AFTER_DC,
     CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS,
     CONFIG_QUEST_IGNORE_AUTO_ACCEPT,
@@ -132,6 +138,7 @@ enum ServerConfigs
     CONFIG_QUEST_POI_ENABLED,
     CONFIG_VMAP_BLIZZLIKE_PVP_LOS,
     CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD,
+    CONFIG_VMAP_LOS_CACHE_SIZE,
     CONFIG_OBJECT_SPARKLES,
     CONFIG_LOW_LEVEL_REGEN_BOOST,
     CONFIG_OBJECT_QUEST_MARKERS,
@@ -162,11 +169,15 @@ enum ServerConfigs
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
     CONFIG_INTERVAL_SAVE,
+    CONFIG_PLAYER_SAVE_STATEMENTS_PER_SECOND,
+    CONFIG_PLAYER_SAVE_MAX_DB_QUEUE,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
     CONFIG_SESSION_ADD_DELAY,
     CONFIG_GAME_TYPE,
     CONFIG_REALM_ZONE,
+    CONFIG_DBC_LOAD_THREADS,
+    CONFIG_WORLD_LOAD_THREADS,
     CONFIG_STRICT_PLAYER_NAMES,
     CONFIG_STRICT_CHARTER_NAMES,
     CONFIG_STRICT_CHANNEL_NAMES,
@@ -293,6 +304,8 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_PRELOAD_THREADS,
+    CONFIG_MAP_PRELOAD_MAX_GRIDS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR,
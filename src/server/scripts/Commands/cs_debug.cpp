@@ -29,7 +29,9 @@
 #include "MapMgr.h"
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
+#include "Timer.h"
 #include "Transport.h"
 #include "Warden.h"
 #include <fstream>
@@ -66,6 +68,11 @@ public:
             { "setphaseshift",  HandleDebugSendSetPhaseShiftCommand,   SEC_ADMINISTRATOR, Console::No },
             { "spellfail",      HandleDebugSendSpellFailCommand,       SEC_ADMINISTRATOR, Console::No }
         };
+        static ChatCommandTable debugProfileCommandTable =
+        {
+            { "start",          HandleDebugProfileStartCommand,        SEC_ADMINISTRATOR, Console::Yes },
+            { "stop",           HandleDebugProfileStopCommand,         SEC_ADMINISTRATOR, Console::Yes }
+        };
         static ChatCommandTable debugCommandTable =
         {
             { "setbit",         HandleDebugSet32BitCommand,            SEC_ADMINISTRATOR, Console::No },
@@ -99,7 +106,8 @@ public:
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No },
             { "mapdata",        HandleDebugMapDataCommand,             SEC_ADMINISTRATOR, Console::No },
-            { "boundary",       HandleDebugBoundaryCommand,            SEC_ADMINISTRATOR, Console::No }
+            { "boundary",       HandleDebugBoundaryCommand,            SEC_ADMINISTRATOR, Console::No },
+            { "profile",        debugProfileCommandTable }
         };
         static ChatCommandTable commandTable =
         {
@@ -1403,6 +1411,48 @@ public:
 
         return true;
     }
+
+    static bool HandleDebugProfileStartCommand(ChatHandler* handler)
+    {
+        if (Profiler::IsCapturing())
+        {
+            handler->SendErrorMessage("A profile capture is already running.");
+            return false;
+        }
+
+        sProfiler->Start();
+        handler->SendSysMessage("Profile capture started, end it with .debug profile stop.");
+        return true;
+    }
+
+    static bool HandleDebugProfileStopCommand(ChatHandler* handler)
+    {
+        if (!Profiler::IsCapturing())
+        {
+            handler->SendErrorMessage("No profile capture is running.");
+            return false;
+        }
+
+        Milliseconds const captureTime = sProfiler->GetCaptureTime();
+        Profiler::Stacks stacks = sProfiler->Stop();
+
+        std::string const fileName = sLog->GetLogsDir() + "profile_" + Acore::Time::TimeToTimestampStr(GetEpochTime(), "%Y-%m-%d_%H_%M_%S") + ".folded";
+        if (!Profiler::WriteCollapsed(fileName, stacks))
+        {
+            handler->SendErrorMessage("Could not write the profile to {}.", fileName);
+            return false;
+        }
+
+        handler->PSendSysMessage("Captured {} stacks in {} ms, written to {}.", stacks.size(), captureTime.count(), fileName);
+
+        // The stacks the most time was spent in themselves
+        std::size_t const shown = std::min<std::size_t>(stacks.size(), 5);
+        std::partial_sort(stacks.begin(), stacks.begin() + shown, stacks.end(), [](auto const& left, auto const& right) { return left.second > right.second; });
+        for (std::size_t i = 0; i < shown; ++i)
+            handler->PSendSysMessage("{} us - {}", stacks[i].second, stacks[i].first);
+
+        return true;
+    }
 };
 
 void AddSC_debug_commandscript()
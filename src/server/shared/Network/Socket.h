@@ -31,7 +31,9 @@
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
-#ifdef BOOST_ASIO_HAS_IOCP
+// Completion based backends (IOCP, io_uring) submit the queued buffer directly instead of
+// waiting for writability and then calling write_some from the network thread
+#if defined(BOOST_ASIO_HAS_IOCP) || defined(BOOST_ASIO_HAS_IO_URING)
 #define AC_SOCKET_USE_IOCP
 #endif
 
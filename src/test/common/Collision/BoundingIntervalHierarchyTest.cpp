@@ -0,0 +1,150 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BoundingIntervalHierarchy.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct BoxBounds
+    {
+        void operator()(G3D::AABox const& box, G3D::AABox& out) const { out = box; }
+    };
+
+    // Slab test of a ray against the boxes the tree was built from
+    class BoxRayCallback
+    {
+    public:
+        explicit BoxRayCallback(std::vector<G3D::AABox> const& boxes) : _boxes(boxes) { }
+
+        bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*stopAtFirstHit*/)
+        {
+            G3D::AABox const& box = _boxes[entry];
+            float tMin = 0.f;
+            float tMax = distance;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                float invDir = 1.f / ray.direction()[axis];
+                float t1 = (box.low()[axis] - ray.origin()[axis]) * invDir;
+                float t2 = (box.high()[axis] - ray.origin()[axis]) * invDir;
+                if (t1 > t2)
+                    std::swap(t1, t2);
+
+                tMin = std::max(tMin, t1);
+                tMax = std::min(tMax, t2);
+                if (tMin > tMax)
+                    return false;
+            }
+
+            distance = tMin;
+            return true;
+        }
+
+    private:
+        std::vector<G3D::AABox> const& _boxes;
+    };
+
+    class BoundingIntervalHierarchyTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::uniform_real_distribution<float> position(0.f, 500.f);
+            std::uniform_real_distribution<float> size(0.5f, 8.f);
+            for (int i = 0; i < 2000; ++i)
+            {
+                G3D::Vector3 low(position(_random), position(_random), position(_random) / 10.f);
+                _boxes.emplace_back(low, low + G3D::Vector3(size(_random), size(_random), size(_random)));
+            }
+
+            BoxBounds bounds;
+            _tree.build(_boxes, bounds);
+        }
+
+        G3D::Ray RandomRay(float& length)
+        {
+            std::uniform_real_distribution<float> position(-20.f, 520.f);
+            G3D::Vector3 start(position(_random), position(_random), position(_random) / 10.f);
+            G3D::Vector3 end(position(_random), position(_random), position(_random) / 10.f);
+            length = (end - start).magnitude();
+            return G3D::Ray::fromOriginAndDirection(start, (end - start) / length);
+        }
+
+        bool ScalarHit(G3D::Ray const& ray, float length)
+        {
+            BoxRayCallback callback(_boxes);
+            bool hit = false;
+            auto anyHit = [&](G3D::Ray const& r, uint32 entry, float& distance, bool stopAtFirstHit)
+            {
+                bool result = callback(r, entry, distance, stopAtFirstHit);
+                hit = hit || result;
+                return result;
+            };
+            _tree.intersectRay(ray, anyHit, length, true);
+            return hit;
+        }
+
+        std::mt19937 _random{ 12345 };
+        std::vector<G3D::AABox> _boxes;
+        BIH _tree;
+    };
+}
+
+TEST_F(BoundingIntervalHierarchyTest, PacketMatchesSingleRays)
+{
+    BoxRayCallback callback(_boxes);
+    uint32 hits = 0;
+    for (int packet = 0; packet < 500; ++packet)
+    {
+        G3D::Ray rays[BIH::RAY_PACKET_SIZE];
+        float lengths[BIH::RAY_PACKET_SIZE];
+        for (uint32 i = 0; i < BIH::RAY_PACKET_SIZE; ++i)
+            rays[i] = RandomRay(lengths[i]);
+
+        uint32 hitMask = _tree.intersectRayPacket(rays, lengths, BIH::RAY_PACKET_SIZE, callback);
+        for (uint32 i = 0; i < BIH::RAY_PACKET_SIZE; ++i)
+        {
+            bool const hit = (hitMask & (1 << i)) != 0;
+            EXPECT_EQ(hit, ScalarHit(rays[i], lengths[i])) << "packet " << packet << " ray " << i;
+            hits += hit;
+        }
+    }
+
+    // both outcomes must be covered for the comparison to mean anything
+    EXPECT_GT(hits, 0u);
+    EXPECT_LT(hits, 500u * BIH::RAY_PACKET_SIZE);
+}
+
+TEST_F(BoundingIntervalHierarchyTest, PartialPacketAndAxisAlignedRays)
+{
+    BoxRayCallback callback(_boxes);
+    G3D::Vector3 const start = _boxes[0].center() - G3D::Vector3(50.f, 0.f, 0.f);
+
+    G3D::Ray rays[2] =
+    {
+        G3D::Ray::fromOriginAndDirection(start, G3D::Vector3(1.f, 0.f, 0.f)),
+        G3D::Ray::fromOriginAndDirection(start, G3D::Vector3(-1.f, 0.f, -0.f))
+    };
+    float lengths[2] = { 100.f, 100.f };
+
+    uint32 hitMask = _tree.intersectRayPacket(rays, lengths, 2, callback);
+    EXPECT_TRUE(hitMask & 1);
+    EXPECT_EQ((hitMask & 2) != 0, ScalarHit(rays[1], lengths[1]));
+    EXPECT_EQ(hitMask & ~3u, 0u);
+}
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryLog.h"
+#include "LogArguments.h"
+#include "LogMessage.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    template<typename... Args>
+    void AddMessage(Acore::BinaryLog::Writer& writer, std::string const& type, Seconds time, fmt::format_string<Args...> format, Args&&... args)
+    {
+        LogMessage message(LOG_LEVEL_INFO, type, {});
+        message.mtime = time;
+        message.format.assign(format.get().data(), format.get().size());
+        Acore::LogArguments::Encode(message.arguments, fmt::make_format_args(args...));
+        writer.Add(message);
+    }
+
+    std::string Write(bool compress)
+    {
+        Acore::BinaryLog::Writer writer(compress);
+        std::string data;
+        writer.Start(data);
+
+        for (uint32 i = 0; i < 100; ++i)
+            AddMessage(writer, "loot", Seconds(1000 + i), "Player {} looted item {} x{}", "Arthas", 19019u + i, -int32(i));
+
+        writer.Flush(data);
+
+        LogMessage text(LOG_LEVEL_ERROR, "server", "already formatted {braces}", "42");
+        text.mtime = 990s;
+        writer.Add(text);
+        writer.Flush(data);
+        return data;
+    }
+}
+
+TEST(BinaryLogTest, ArgumentsFormatLikeTheCaller)
+{
+    std::string encoded;
+    std::string name = "Thrall";
+    int32 level = 42;
+    int64 negative = -7;
+    uint64 large = 18446744073709551615ull;
+    bool flag = true;
+    char letter = 'x';
+    float ratio = 0.1f;
+    double precise = 2.5;
+    Acore::LogArguments::Encode(encoded, fmt::make_format_args(name, level, negative, large, flag, letter, ratio, precise));
+
+    EXPECT_EQ(Acore::LogArguments::Format("{} {} {} {} {} {} {} {:.2f}", encoded),
+        fmt::format("{} {} {} {} {} {} {} {:.2f}", name, level, negative, large, flag, letter, ratio, precise));
+
+    EXPECT_EQ(Acore::LogArguments::Format("{} {}", encoded).substr(0, 9), "Thrall 42");
+    EXPECT_NE(Acore::LogArguments::Format("{20}", encoded).find("Wrong format occurred"), std::string::npos);
+}
+
+TEST(BinaryLogTest, ReadsBackWhatWasWritten)
+{
+    for (bool compress : { false, true })
+    {
+        std::string const data = Write(compress);
+        Acore::BinaryLog::Reader reader(data);
+        Acore::BinaryLog::Record record;
+
+        for (uint32 i = 0; i < 100; ++i)
+        {
+            ASSERT_TRUE(reader.Next(record));
+            EXPECT_EQ(record.Level, LOG_LEVEL_INFO);
+            EXPECT_EQ(record.Type, "loot");
+            EXPECT_EQ(record.Time, Seconds(1000 + i));
+            EXPECT_EQ(record.GetText(), fmt::format("Player Arthas looted item {} x{}", 19019 + i, -int32(i)));
+        }
+
+        ASSERT_TRUE(reader.Next(record));
+        EXPECT_EQ(record.Level, LOG_LEVEL_ERROR);
+        EXPECT_EQ(record.Time, 990s);
+        EXPECT_EQ(record.GetText(), "already formatted {braces}");
+        EXPECT_EQ(record.Param1, "42");
+
+        EXPECT_FALSE(reader.Next(record));
+        EXPECT_FALSE(reader.IsDamaged());
+    }
+}
+
+TEST(BinaryLogTest, CompressionAndInterningShrinkTheFile)
+{
+    std::string const raw = Write(false);
+    std::string const compressed = Write(true);
+
+    // The format string and type are written once, not per message
+    EXPECT_LT(raw.size(), 100 * std::string_view("Player Arthas looted item 19019 x-1").size());
+    EXPECT_LT(compressed.size(), raw.size());
+}
+
+TEST(BinaryLogTest, AppendedStreamsAndDamage)
+{
+    std::string data = Write(false) + Write(true);
+
+    Acore::BinaryLog::Reader reader(data);
+    Acore::BinaryLog::Record record;
+    uint32 count = 0;
+    while (reader.Next(record))
+        ++count;
+
+    EXPECT_EQ(count, 202u);
+    EXPECT_FALSE(reader.IsDamaged());
+
+    data.resize(data.size() - 5);
+    Acore::BinaryLog::Reader truncated(data);
+    count = 0;
+    while (truncated.Next(record))
+        ++count;
+
+    EXPECT_EQ(count, 201u);
+    EXPECT_TRUE(truncated.IsDamaged());
+}
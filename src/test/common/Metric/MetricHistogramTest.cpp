@@ -0,0 +1,69 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricExporter.h"
+#include "MetricHistogram.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(MetricHistogramTest, BucketValueStaysClose)
+{
+    for (uint64 value : std::vector<uint64>{ 0, 1, 31, 32, 33, 63, 64, 1000, 123456, 987654321, MetricHistogram::MaxValue })
+    {
+        std::size_t const index = MetricHistogram::GetBucketIndex(value);
+        ASSERT_LT(index, MetricHistogram::BucketCount);
+
+        uint64 const bucketValue = MetricHistogram::GetBucketValue(index);
+        EXPECT_EQ(MetricHistogram::GetBucketIndex(bucketValue), index);
+        EXPECT_LE(double(bucketValue > value ? bucketValue - value : value - bucketValue), value / 32.0);
+    }
+}
+
+TEST(MetricHistogramTest, BucketsAreOrdered)
+{
+    for (std::size_t i = 1; i < MetricHistogram::BucketCount; ++i)
+        ASSERT_LT(MetricHistogram::GetBucketValue(i - 1), MetricHistogram::GetBucketValue(i));
+}
+
+TEST(MetricHistogramTest, Quantiles)
+{
+    MetricHistogram histogram;
+    for (uint64 value = 1; value <= 1000; ++value)
+        histogram.Record(value);
+
+    EXPECT_EQ(histogram.GetCount(), 1000u);
+    EXPECT_EQ(histogram.GetSum(), 500500u);
+
+    MetricHistogram::Counts counts = histogram.GetCounts();
+    EXPECT_NEAR(double(MetricHistogram::GetValueAtQuantile(counts, 0.5)), 500.0, 500.0 / 32);
+    EXPECT_NEAR(double(MetricHistogram::GetValueAtQuantile(counts, 0.99)), 990.0, 990.0 / 32);
+    EXPECT_EQ(MetricHistogram::GetValueAtQuantile(counts, 0.0), 1u);
+    EXPECT_EQ(MetricHistogram::GetValueAtQuantile(MetricHistogram::Counts(MetricHistogram::BucketCount), 0.5), 0u);
+}
+
+TEST(MetricHistogramTest, ExporterResponse)
+{
+    auto render = []() { return std::string("up 1\n"); };
+
+    std::string response = MetricExporter::BuildResponse("GET /metrics HTTP/1.1", render);
+    EXPECT_TRUE(response.starts_with("HTTP/1.1 200 OK\r\n"));
+    EXPECT_TRUE(response.ends_with("\r\n\r\nup 1\n"));
+    EXPECT_NE(response.find("Content-Length: 5\r\n"), std::string::npos);
+
+    EXPECT_TRUE(MetricExporter::BuildResponse("GET / HTTP/1.1", render).starts_with("HTTP/1.1 404"));
+    EXPECT_TRUE(MetricExporter::BuildResponse("POST /metrics HTTP/1.1", render).starts_with("HTTP/1.1 405"));
+}
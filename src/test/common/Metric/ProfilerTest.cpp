@@ -0,0 +1,95 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+#include "gtest/gtest.h"
+#include <thread>
+
+namespace
+{
+    uint64 FindStack(Profiler::Stacks const& stacks, std::string_view name)
+    {
+        for (auto const& [stack, time] : stacks)
+            if (stack == name)
+                return time;
+
+        return 0;
+    }
+}
+
+TEST(ProfilerTest, NothingRecordedOutsideCapture)
+{
+    {
+        ACORE_PROFILE_SCOPE("Outside");
+    }
+
+    sProfiler->Start();
+    Profiler::Stacks stacks = sProfiler->Stop();
+
+    EXPECT_TRUE(stacks.empty());
+}
+
+TEST(ProfilerTest, NestedScopesCountSelfTime)
+{
+    sProfiler->Start();
+    {
+        ACORE_PROFILE_SCOPE("World::Update");
+        std::this_thread::sleep_for(5ms);
+        {
+            ACORE_PROFILE_SCOPE("Map {}", 571);
+            std::this_thread::sleep_for(20ms);
+        }
+    }
+    Profiler::Stacks stacks = sProfiler->Stop();
+
+    ASSERT_EQ(stacks.size(), 2u);
+    EXPECT_EQ(stacks[0].first, "World::Update");
+    EXPECT_EQ(stacks[1].first, "World::Update;Map 571");
+
+    uint64 const outer = FindStack(stacks, "World::Update");
+    uint64 const inner = FindStack(stacks, "World::Update;Map 571");
+    EXPECT_GE(outer, 5000u);
+    EXPECT_LT(outer, inner);
+    EXPECT_GE(inner, 20000u);
+}
+
+TEST(ProfilerTest, SeparatorInLabelIsReplaced)
+{
+    sProfiler->Start();
+    {
+        ACORE_PROFILE_SCOPE("a;b");
+        std::this_thread::sleep_for(1ms);
+    }
+    Profiler::Stacks stacks = sProfiler->Stop();
+
+    ASSERT_EQ(stacks.size(), 1u);
+    EXPECT_EQ(stacks[0].first, "a:b");
+}
+
+TEST(ProfilerTest, OtherThreadsAreMerged)
+{
+    sProfiler->Start();
+    std::thread([]()
+    {
+        ACORE_PROFILE_SCOPE("Worker");
+        std::this_thread::sleep_for(1ms);
+    }).join();
+    Profiler::Stacks stacks = sProfiler->Stop();
+
+    ASSERT_EQ(stacks.size(), 1u);
+    EXPECT_EQ(stacks[0].first, "Worker");
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Duration.h"
+#include "PCQueue.h"
+#include "gtest/gtest.h"
+#include <thread>
+
+TEST(PCQueueTest, WaitAndPopUntilTimesOut)
+{
+    ProducerConsumerQueue<int> queue;
+    int value = 0;
+
+    EXPECT_FALSE(queue.WaitAndPopUntil(value, std::chrono::steady_clock::now() + 5ms));
+    EXPECT_EQ(value, 0);
+}
+
+TEST(PCQueueTest, WaitAndPopUntilWakesOnPush)
+{
+    ProducerConsumerQueue<int> queue;
+    int value = 0;
+
+    std::thread producer([&]()
+    {
+        std::this_thread::sleep_for(5ms);
+        queue.Push(7);
+    });
+
+    EXPECT_TRUE(queue.WaitAndPopUntil(value, std::chrono::steady_clock::now() + 10s));
+    EXPECT_EQ(value, 7);
+
+    producer.join();
+}
+
+TEST(PCQueueTest, WaitAndPopUntilStopsOnShutdown)
+{
+    ProducerConsumerQueue<int> queue;
+    int value = 0;
+
+    queue.Shutdown();
+
+    EXPECT_FALSE(queue.WaitAndPopUntil(value, std::chrono::steady_clock::now() + 10s));
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "SPSCRingBuffer.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(SPSCRingBufferTest, CapacityRoundsUpToPowerOfTwo)
+{
+    Acore::SPSCRingBuffer<int> buffer(100);
+    EXPECT_EQ(buffer.Capacity(), 128u);
+    EXPECT_EQ(buffer.Size(), 0u);
+}
+
+TEST(SPSCRingBufferTest, PushFailsWhenFull)
+{
+    Acore::SPSCRingBuffer<int> buffer(4);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(buffer.Push([i](int& slot) { slot = i; }));
+
+    EXPECT_FALSE(buffer.Push([](int& slot) { slot = 4; }));
+    EXPECT_EQ(buffer.Size(), 4u);
+
+    std::vector<int> consumed;
+    EXPECT_EQ(buffer.Consume([&](int value) { consumed.push_back(value); }), 4u);
+    EXPECT_EQ(consumed, (std::vector<int>{ 0, 1, 2, 3 }));
+
+    EXPECT_TRUE(buffer.Push([](int& slot) { slot = 5; }));
+    EXPECT_EQ(buffer.Size(), 1u);
+}
+
+TEST(SPSCRingBufferTest, SlotsKeepTheirBuffers)
+{
+    Acore::SPSCRingBuffer<std::string> buffer(2);
+    buffer.Push([](std::string& slot) { slot.assign(100, 'x'); });
+    buffer.Consume([](std::string const&) { });
+    buffer.Push([](std::string& slot) { slot.assign(100, 'y'); });
+    buffer.Consume([](std::string const&) { });
+
+    // Back at the first slot, which still has the capacity of the first string
+    buffer.Push([](std::string& slot)
+    {
+        EXPECT_GE(slot.capacity(), 100u);
+        slot = "z";
+    });
+}
+
+TEST(SPSCRingBufferTest, ProducerAndConsumerThreads)
+{
+    constexpr uint32 count = 100000;
+    Acore::SPSCRingBuffer<uint32> buffer(64);
+
+    std::thread producer([&]()
+    {
+        for (uint32 i = 0; i < count;)
+        {
+            if (buffer.Push([i](uint32& slot) { slot = i; }))
+                ++i;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    uint32 expected = 0;
+    bool ordered = true;
+    while (expected < count)
+    {
+        std::size_t consumed = buffer.Consume([&](uint32 value)
+        {
+            ordered = ordered && value == expected;
+            ++expected;
+        });
+
+        if (!consumed)
+            std::this_thread::yield();
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(buffer.Size(), 0u);
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskGraph.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST(TaskGraphTest, SingleThreadKeepsDeclarationOrder)
+{
+    Acore::TaskGraph graph;
+    std::vector<std::size_t> order;
+
+    Acore::TaskGraph::TaskId a = graph.AddTask("a", [&]() { order.push_back(0); });
+    Acore::TaskGraph::TaskId b = graph.AddTask("b", [&]() { order.push_back(1); });
+    Acore::TaskGraph::TaskId c = graph.AddTask("c", [&]() { order.push_back(2); }, { a });
+    graph.AddTask("d", [&]() { order.push_back(3); }, { b, c });
+
+    graph.Run(1);
+
+    EXPECT_EQ(order, (std::vector<std::size_t>{ 0, 1, 2, 3 }));
+}
+
+TEST(TaskGraphTest, DependenciesFinishFirst)
+{
+    Acore::TaskGraph graph;
+    std::mutex lock;
+    std::vector<std::size_t> finished;
+
+    auto record = [&](std::size_t id)
+    {
+        return [&, id]()
+        {
+            std::this_thread::sleep_for(1ms);
+            std::lock_guard<std::mutex> guard(lock);
+            finished.push_back(id);
+        };
+    };
+
+    std::vector<Acore::TaskGraph::TaskId> leaves;
+    for (std::size_t i = 0; i < 8; ++i)
+        leaves.push_back(graph.AddTask("leaf", record(i)));
+
+    Acore::TaskGraph::TaskId join = graph.AddTask("join", record(8));
+    for (Acore::TaskGraph::TaskId leaf : leaves)
+        graph.AddDependency(join, leaf);
+
+    graph.AddTask("tail", record(9), { join });
+
+    graph.Run(4);
+
+    ASSERT_EQ(finished.size(), 10u);
+    EXPECT_EQ(finished[8], 8u);
+    EXPECT_EQ(finished[9], 9u);
+}
+
+TEST(TaskGraphTest, IndependentTasksRunConcurrently)
+{
+    Acore::TaskGraph graph;
+    std::atomic<uint32> running = 0;
+    std::atomic<uint32> peak = 0;
+
+    for (uint32 i = 0; i < 4; ++i)
+    {
+        graph.AddTask("task", [&]()
+        {
+            uint32 now = ++running;
+            for (uint32 seen = peak; now > seen && !peak.compare_exchange_weak(seen, now);)
+                ;
+
+            std::this_thread::sleep_for(20ms);
+            --running;
+        });
+    }
+
+    graph.Run(4);
+
+    EXPECT_GT(peak.load(), 1u);
+}
+
+TEST(TaskGraphTest, CriticalPathFollowsSlowestChain)
+{
+    Acore::TaskGraph graph;
+
+    Acore::TaskGraph::TaskId fast = graph.AddTask("fast", []() { });
+    Acore::TaskGraph::TaskId slow = graph.AddTask("slow", []() { std::this_thread::sleep_for(20ms); });
+    Acore::TaskGraph::TaskId end = graph.AddTask("end", []() { }, { fast, slow });
+    graph.AddTask("side", []() { });
+
+    graph.Run(2);
+
+    std::vector<Acore::TaskGraph::TaskId> path = graph.GetCriticalPath();
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(path[0], slow);
+    EXPECT_EQ(path[1], end);
+    EXPECT_GE(graph.GetTotalTime(), graph.GetTime(slow));
+}
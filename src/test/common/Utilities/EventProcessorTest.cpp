@@ -0,0 +1,168 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    class RecordingEvent : public BasicEvent
+    {
+    public:
+        RecordingEvent(std::vector<uint32>& log, uint32 id) : _log(log), _id(id) { }
+
+        bool Execute(uint64, uint32) override
+        {
+            _log.push_back(_id);
+            return true;
+        }
+
+        void Abort(uint64) override { _log.push_back(_id | 0x80000000); }
+
+    private:
+        std::vector<uint32>& _log;
+        uint32 _id;
+    };
+
+    // Events with the same time run in the order they were (re)scheduled
+    struct ScheduledEvent
+    {
+        uint64 Time;
+        uint32 Sequence;
+        uint32 Id;
+
+        bool operator<(ScheduledEvent const& right) const { return std::tie(Time, Sequence) < std::tie(right.Time, right.Sequence); }
+    };
+}
+
+TEST(EventProcessorTest, ExecutesInTimeThenInsertionOrder)
+{
+    std::vector<uint32> executed;
+    EventProcessor processor;
+    processor.AddEventAtOffset(new RecordingEvent(executed, 1), 100ms);
+    processor.AddEventAtOffset(new RecordingEvent(executed, 2), 50ms);
+    processor.AddEventAtOffset(new RecordingEvent(executed, 3), 100ms);
+    processor.AddEventAtOffset(new RecordingEvent(executed, 4), 2h);
+
+    processor.Update(49);
+    EXPECT_TRUE(executed.empty());
+
+    processor.Update(51);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2, 1, 3 }));
+
+    processor.Update(2 * 60 * 60 * 1000);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2, 1, 3, 4 }));
+}
+
+TEST(EventProcessorTest, ScheduledAbortAndCancelGroup)
+{
+    std::vector<uint32> executed;
+    EventProcessor processor;
+
+    RecordingEvent* aborted = new RecordingEvent(executed, 1);
+    processor.AddEventAtOffset(aborted, 10ms);
+    processor.AddEventAtOffset([&executed]() { executed.push_back(2); }, 10ms, 7);
+    processor.AddEventAtOffset(new RecordingEvent(executed, 3), 10ms);
+
+    aborted->ScheduleAbort();
+    processor.CancelEventGroup(7);
+    processor.Update(10);
+
+    EXPECT_EQ(executed, (std::vector<uint32>{ 1 | 0x80000000, 3 }));
+}
+
+TEST(EventProcessorTest, ModifyEventTime)
+{
+    std::vector<uint32> executed;
+    EventProcessor processor;
+
+    RecordingEvent* moved = new RecordingEvent(executed, 1);
+    processor.AddEventAtOffset(moved, 10s);
+    processor.AddEventAtOffset(new RecordingEvent(executed, 2), 20ms);
+    processor.ModifyEventTime(moved, 5ms);
+
+    processor.Update(20);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 1, 2 }));
+}
+
+TEST(EventProcessorTest, RandomScheduleKeepsOrder)
+{
+    std::mt19937 rng(42);
+    std::vector<uint32> executed;
+    std::vector<uint32> expected;
+    std::set<ScheduledEvent> reference;
+    std::vector<std::pair<uint32, RecordingEvent*>> pending;
+    EventProcessor processor;
+    uint64 now = 0;
+    uint32 sequence = 0;
+
+    for (uint32 id = 0; id < 20000; ++id)
+    {
+        switch (rng() % 4)
+        {
+            case 0:
+            case 1:
+            {
+                // mostly short delays, a few long enough to reach the upper levels of a timing wheel
+                uint64 delay = (rng() % 8) ? rng() % 2000 : rng() % 50000000;
+                RecordingEvent* event = new RecordingEvent(executed, id);
+                processor.AddEventAtOffset(event, Milliseconds(delay));
+                reference.insert({ now + delay, ++sequence, id });
+                pending.emplace_back(id, event);
+                break;
+            }
+            case 2:
+            {
+                if (pending.empty())
+                    break;
+
+                std::size_t index = rng() % pending.size();
+                uint64 time = now + rng() % 500;
+                processor.ModifyEventTime(pending[index].second, Milliseconds(time));
+
+                auto itr = std::find_if(reference.begin(), reference.end(), [&](ScheduledEvent const& scheduled) { return scheduled.Id == pending[index].first; });
+                ASSERT_NE(itr, reference.end());
+                uint32 movedId = itr->Id;
+                reference.erase(itr);
+                reference.insert({ time, ++sequence, movedId });
+                break;
+            }
+            default:
+            {
+                uint32 diff = rng() % 300;
+                now += diff;
+                processor.Update(diff);
+
+                while (!reference.empty() && reference.begin()->Time <= now)
+                {
+                    uint32 doneId = reference.begin()->Id;
+                    expected.push_back(doneId);
+                    std::erase_if(pending, [doneId](auto const& event) { return event.first == doneId; });
+                    reference.erase(reference.begin());
+                }
+
+                ASSERT_EQ(executed, expected);
+                break;
+            }
+        }
+    }
+}
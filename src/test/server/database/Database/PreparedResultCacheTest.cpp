@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PreparedResultCache.h"
+#include "PreparedStatement.h"
+#include "QueryResult.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    enum TestStatements : uint32
+    {
+        SEL_DATA,
+        REP_DATA,
+        DEL_ALL_DATA,
+        SEL_OTHER
+    };
+
+    class PreparedResultCacheTest : public ::testing::Test
+    {
+    protected:
+        PreparedResultCacheTest() : _cache(16, 60s)
+        {
+            _cache.AddStatement(SEL_DATA);
+            _cache.AddStatement(SEL_OTHER);
+            _cache.AddInvalidation(REP_DATA, SEL_DATA, 1);
+            _cache.AddInvalidation(DEL_ALL_DATA, SEL_DATA);
+        }
+
+        // Results without rows are cached as well, the number of database reads is what matters here
+        void Query(uint32 index, uint32 key)
+        {
+            PreparedStatementBase stmt(index, 1);
+            stmt.SetData(0, key);
+            _cache.Query(&stmt, [this]() { ++_reads; return nullptr; });
+        }
+
+        std::shared_ptr<void> Write(uint32 index, uint32 key)
+        {
+            PreparedStatementBase stmt(index, 2);
+            stmt.SetData(0, 0);
+            stmt.SetData(1, key);
+            return _cache.BeginWrite(&stmt);
+        }
+
+        PreparedResultCache _cache;
+        uint32 _reads = 0;
+    };
+}
+
+TEST_F(PreparedResultCacheTest, RepeatedQueryIsServedFromCache)
+{
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 2);
+    Query(SEL_OTHER, 1);
+
+    EXPECT_EQ(_reads, 3u);
+
+    PreparedResultCacheStats stats = _cache.Collect();
+    EXPECT_EQ(stats.Hits, 1u);
+    EXPECT_EQ(stats.Misses, 3u);
+    EXPECT_EQ(stats.Entries, 3u);
+}
+
+TEST_F(PreparedResultCacheTest, WriteDropsOnlyItsKey)
+{
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 2);
+
+    EXPECT_NE(Write(REP_DATA, 1), nullptr);
+    EXPECT_EQ(Write(SEL_OTHER, 1), nullptr);
+
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 2);
+
+    EXPECT_EQ(_reads, 3u);
+}
+
+TEST_F(PreparedResultCacheTest, ReadDuringWriteIsNotKept)
+{
+    std::shared_ptr<void> write = Write(REP_DATA, 1);
+
+    // The write may not have reached the database yet
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 1);
+    EXPECT_EQ(_reads, 2u);
+
+    write.reset();
+
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 1);
+    EXPECT_EQ(_reads, 3u);
+}
+
+TEST_F(PreparedResultCacheTest, WritesToAllKeysDropEverythingOfTheStatement)
+{
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 2);
+    Query(SEL_OTHER, 1);
+
+    Write(DEL_ALL_DATA, 0);
+
+    Query(SEL_DATA, 1);
+    Query(SEL_DATA, 2);
+    Query(SEL_OTHER, 1);
+    EXPECT_EQ(_reads, 5u);
+
+    _cache.BeginAdhocWrite();
+
+    Query(SEL_OTHER, 1);
+    EXPECT_EQ(_reads, 6u);
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerSaveCache.h"
+#include "gtest/gtest.h"
+#include <memory>
+
+namespace
+{
+    std::unique_ptr<PreparedStatementBase> MakeAuraRow(uint32 spell, int32 duration)
+    {
+        auto stmt = std::make_unique<PreparedStatementBase>(0, 6);
+        stmt->SetData(0, uint32(1));
+        stmt->SetData(1, uint64(2));
+        stmt->SetData(2, uint64(0));
+        stmt->SetData(3, spell);
+        stmt->SetData(4, uint8(1));
+        stmt->SetData(5, duration);
+        return stmt;
+    }
+}
+
+TEST(PlayerSaveCacheTest, FirstSaveWritesEverything)
+{
+    PlayerSaveCache cache;
+
+    EXPECT_FALSE(cache.BeginSave(SAVE_CACHE_AURAS, false));
+    EXPECT_TRUE(cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(100, -1).get()));
+    EXPECT_TRUE(cache.EndSave(SAVE_CACHE_AURAS).empty());
+
+    EXPECT_TRUE(cache.BeginSave(SAVE_CACHE_AURAS, false));
+}
+
+TEST(PlayerSaveCacheTest, SkipsUnchangedRowsAndReportsRemovedOnes)
+{
+    PlayerSaveCache cache;
+
+    cache.BeginSave(SAVE_CACHE_AURAS, false);
+    cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(100, -1).get());
+    cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(200, 60000).get());
+    cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(300, -1).get());
+    cache.EndSave(SAVE_CACHE_AURAS);
+
+    ASSERT_TRUE(cache.BeginSave(SAVE_CACHE_AURAS, false));
+    EXPECT_FALSE(cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(100, -1).get()));
+    EXPECT_TRUE(cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(200, 30000).get()));
+
+    std::vector<PlayerSaveCache::Key> removed = cache.EndSave(SAVE_CACHE_AURAS);
+    ASSERT_EQ(removed.size(), 1u);
+    ASSERT_EQ(removed[0].size(), 5u);
+    EXPECT_EQ(std::get<uint32>(removed[0][3].data), 300u);
+}
+
+TEST(PlayerSaveCacheTest, FullSaveForgetsRows)
+{
+    PlayerSaveCache cache;
+
+    cache.BeginSave(SAVE_CACHE_AURAS, false);
+    cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(100, -1).get());
+    cache.EndSave(SAVE_CACHE_AURAS);
+
+    EXPECT_FALSE(cache.BeginSave(SAVE_CACHE_AURAS, true));
+    EXPECT_TRUE(cache.Update(SAVE_CACHE_AURAS, MakeAuraRow(100, -1).get()));
+    EXPECT_TRUE(cache.EndSave(SAVE_CACHE_AURAS).empty());
+
+    cache.Reset();
+    EXPECT_FALSE(cache.BeginSave(SAVE_CACHE_AURAS, false));
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Appender.h"
+#include "BinaryLog.h"
+#include "LogMessage.h"
+#include "MappedFile.h"
+#include <fmt/format.h>
+
+// Prints binary log files written by AppenderBinary as text, in the layout of the file appender with all prefixes
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        fmt::print(stderr, "usage: {} <binary log file> [more files...]\n", argv[0]);
+        return 1;
+    }
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::unique_ptr<Acore::MappedFile> file = Acore::MappedFile::Open(argv[i]);
+        if (!file)
+        {
+            fmt::print(stderr, "Can not open {}\n", argv[i]);
+            result = 1;
+            continue;
+        }
+
+        Acore::BinaryLog::Reader reader(std::string_view(reinterpret_cast<char const*>(file->GetData()), file->GetSize()));
+        Acore::BinaryLog::Record record;
+        while (reader.Next(record))
+        {
+            fmt::print("{} {} [{}] ", LogMessage::getTimeStr(record.Time), Appender::getLogLevelString(record.Level), record.Type);
+            if (!record.Param1.empty())
+                fmt::print("({}) ", record.Param1);
+
+            fmt::print("{}\n", record.GetText());
+        }
+
+        if (reader.IsDamaged())
+        {
+            fmt::print(stderr, "{} contains damaged data, the messages after it are lost\n", argv[i]);
+            result = 1;
+        }
+    }
+
+    return result;
+}